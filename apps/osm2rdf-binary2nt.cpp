@@ -0,0 +1,82 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "osm2rdf/Version.h"
+#include "osm2rdf/config/Config.h"
+#include "osm2rdf/config/ExitCode.h"
+#include "osm2rdf/ttl/BinaryReader.h"
+#include "osm2rdf/ttl/Format.h"
+#include "osm2rdf/ttl/Writer.h"
+#include "osm2rdf/util/Output.h"
+#include "osm2rdf/util/Time.h"
+
+// Converts the output of osm2rdf --output-format binary back to N-Triples,
+// written to stdout. Reads from the given file or from stdin.
+int main(int argc, char** argv) {
+  if (argc > 2) {
+    std::cerr << "Usage: " << argv[0] << " [INPUT]" << std::endl;
+    std::exit(osm2rdf::config::ExitCode::FAILURE);
+  }
+  std::cerr << osm2rdf::util::currentTimeFormatted()
+            << "osm2rdf-binary2nt :: " << osm2rdf::version::GIT_INFO
+            << " :: BEGIN" << std::endl;
+
+  std::ifstream file;
+  std::istream* in = &std::cin;
+  if (argc == 2) {
+    file.open(argv[1], std::ios::binary);
+    if (!file) {
+      std::cerr << "Could not open input file: " << argv[1] << std::endl;
+      std::exit(osm2rdf::config::ExitCode::INPUT_NOT_EXISTS);
+    }
+    in = &file;
+  }
+
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+
+  try {
+    osm2rdf::util::Output output{config, config.output};
+    output.open();
+    osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT> writer{config, &output};
+    const size_t count = osm2rdf::ttl::BinaryReader::convert(in, &writer);
+    output.flush();
+    output.close();
+    std::cerr << osm2rdf::util::currentTimeFormatted() << "converted "
+              << count << " triples" << std::endl;
+  } catch (const std::runtime_error& e) {
+    std::cerr << osm2rdf::util::currentTimeFormatted()
+              << "osm2rdf-binary2nt :: " << osm2rdf::version::GIT_INFO
+              << " :: ERROR" << std::endl;
+    std::cerr << e.what() << std::endl;
+    std::exit(osm2rdf::config::ExitCode::FAILURE);
+  }
+  std::cerr << osm2rdf::util::currentTimeFormatted()
+            << "osm2rdf-binary2nt :: " << osm2rdf::version::GIT_INFO
+            << " :: FINISHED" << std::endl;
+  std::exit(osm2rdf::config::ExitCode::SUCCESS);
+}
@@ -19,13 +19,16 @@
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include "osm2rdf/Version.h"
 #include "osm2rdf/config/Config.h"
+#include "osm2rdf/config/Constants.h"
 #include "osm2rdf/config/ExitCode.h"
 #include "osm2rdf/osm/OsmiumHandler.h"
 #include "osm2rdf/ttl/Writer.h"
+#include "osm2rdf/util/Output.h"
 #include "osm2rdf/util/Time.h"
 #include "osmium/util/memory.hpp"
 
@@ -45,9 +48,30 @@ void run(const osm2rdf::config::Config& config) {
   }
   osm2rdf::ttl::Writer<T> writer{config, &output};
   writer.writeHeader();
-  writer.writeMetadata();
+  if (config.spatialStripe == 0) {
+    // Only write metadata once for all stripes
+    writer.writeMetadata();
+  }
+
+  // Optional separate output for the spatial relation triples
+  const osm2rdf::config::Config relConfig = config.getSpatialRelationsConfig();
+  std::unique_ptr<osm2rdf::util::Output> relOutput;
+  std::unique_ptr<osm2rdf::ttl::Writer<T>> relWriter;
+  if (!config.spatialRelationsOutput.empty() && !config.noGeometricRelations) {
+    relOutput = std::make_unique<osm2rdf::util::Output>(relConfig,
+                                                        relConfig.output);
+    if (!relOutput->open()) {
+      std::cerr << "Error opening outputfile: " << relConfig.output
+                << std::endl;
+      exit(1);
+    }
+    relWriter =
+        std::make_unique<osm2rdf::ttl::Writer<T>>(relConfig, relOutput.get());
+    relWriter->writeHeader();
+  }
 
-  osm2rdf::osm::GeometryHandler<T> geomHandler(config, &writer);
+  osm2rdf::osm::GeometryHandler<T> geomHandler(
+      config, relWriter ? relWriter.get() : &writer);
 
   {
     osm2rdf::osm::FactHandler<T> factHandler(config, &writer);
@@ -57,6 +81,14 @@ void run(const osm2rdf::config::Config& config) {
     osmiumHandler.handle();
   }
 
+  if (relOutput) {
+    // Facts are complete, the output can already be used
+    writer.closeStatements();
+    output.close();
+    std::cerr << osm2rdf::util::currentTimeFormatted() << "Facts written to "
+              << config.output << std::endl;
+  }
+
   if (!config.noGeometricRelations) {
     std::cerr << std::endl;
     std::cerr << osm2rdf::util::currentTimeFormatted()
@@ -71,11 +103,20 @@ void run(const osm2rdf::config::Config& config) {
             << "Memory used: " << memory.peak() << " MBytes" << std::endl;
 
   // All work done, close output
-  output.close();
+  if (relOutput) {
+    relWriter->closeStatements();
+    relOutput->close();
+  } else {
+    writer.closeStatements();
+    output.close();
+  }
 
   // Write final RDF statistics if requested
   if (config.writeRDFStatistics) {
     writer.writeStatisticJson(config.rdfStatisticsPath);
+    if (relWriter) {
+      relWriter->writeStatisticJson(relConfig.rdfStatisticsPath);
+    }
   }
 }
 
@@ -93,12 +134,19 @@ int main(int argc, char** argv) {
 #endif
 
   try {
-    if (config.outputFormat == "qlever") {
+    if (!config.mergeSpatialStripes.empty()) {
+      if (!osm2rdf::util::Output::merge(config.mergeSpatialStripes,
+                                        config.output)) {
+        std::exit(osm2rdf::config::ExitCode::FAILURE);
+      }
+    } else if (config.outputFormat == "qlever") {
       run<osm2rdf::ttl::format::QLEVER>(config);
     } else if (config.outputFormat == "nt") {
       run<osm2rdf::ttl::format::NT>(config);
     } else if (config.outputFormat == "ttl") {
       run<osm2rdf::ttl::format::TTL>(config);
+    } else if (config.outputFormat == "binary") {
+      run<osm2rdf::ttl::format::BINARY>(config);
     } else {
       std::cerr << osm2rdf::util::currentTimeFormatted()
                 << "osm2rdf :: " << osm2rdf::version::GIT_INFO << " :: ERROR"
@@ -59,7 +59,16 @@ struct Config {
   bool noNodeGeometricRelations = false;
   bool noRelationGeometricRelations = false;
   bool noWayGeometricRelations = false;
-  double simplifyGeometries = 0;
+  bool simplifyGeometries = false;
+  bool reduceContains = false;
+
+  // Longitude stripe to compute spatial relations for, disabled if
+  // numSpatialStripes is 0.
+  size_t spatialStripe = 0;
+  size_t numSpatialStripes = 0;
+
+  // Partial stripe outputs to concatenate into the output
+  std::vector<std::string> mergeSpatialStripes;
 
   SourceDataset sourceDataset = OSM;
 
@@ -72,6 +81,7 @@ struct Config {
   bool addWayMetadata = false;
   bool addMemberTriples = true;
   bool addWayNodeSpatialMetadata = false;
+  bool skolemizeMembers = false;
   bool skipWikiLinks = false;
   bool addOsmMetadata = true;
 
@@ -92,6 +102,7 @@ struct Config {
 
   // Auxilary geo files
   std::vector<std::string> auxGeoFiles;
+  bool auxGeoFilesCache = false;
 
   // Statistics
   bool writeRDFStatistics = false;
@@ -107,11 +118,22 @@ struct Config {
   // Output, empty for stdout
   std::filesystem::path output;
   std::string outputFormat = "qlever";
+  // Write consecutive triples with the same subject as one statement, only
+  // used for ttl and qlever.
+  bool outputGroupSubjects = false;
   osm2rdf::util::OutputMergeMode mergeOutput =
       osm2rdf::util::OutputMergeMode::CONCATENATE;
   CompressFormat outputCompress = BZ2;
   bool outputKeepFiles = false;
 
+  // Separate output for spatial relation triples, empty to write them into
+  // the output
+  std::filesystem::path spatialRelationsOutput;
+  CompressFormat spatialRelationsOutputCompress = BZ2;
+  // Merge mode of the separate output, kept when the output goes to stdout
+  osm2rdf::util::OutputMergeMode spatialRelationsMergeOutput =
+      osm2rdf::util::OutputMergeMode::CONCATENATE;
+
   // osmium location cache
   std::filesystem::path cache{std::filesystem::temp_directory_path()};
 
@@ -124,6 +146,9 @@ struct Config {
   // Generate the information string containing the current settings.
   [[nodiscard]] std::string getInfo(std::string_view prefix) const;
 
+  // Generate the config for the separate spatial relations output.
+  [[nodiscard]] Config getSpatialRelationsConfig() const;
+
   // Generate a path inside the cache directory.
   [[nodiscard]] std::filesystem::path getTempPath(
       const std::string& path, const std::string& suffix) const;
@@ -30,6 +30,7 @@ const static inline std::string GZ_EXTENSION = ".gz";
 const static inline std::string STATS_EXTENSION = ".stats";
 const static inline std::string CONTAINS_STATS_EXTENSION = ".contains-stats";
 const static inline std::string JSON_EXTENSION = ".json";
+const static inline std::string AUX_GEO_CACHE_EXTENSION = ".o2rgeo";
 
 const static inline std::string HEADER = "Config";
 
@@ -66,7 +67,16 @@ const static inline std::string OUTPUT_FORMAT_INFO = "Output format:";
 const static inline std::string OUTPUT_FORMAT_OPTION_SHORT = "";
 const static inline std::string OUTPUT_FORMAT_OPTION_LONG = "output-format";
 const static inline std::string OUTPUT_FORMAT_OPTION_HELP =
-    "Output format, valid values: nt, ttl, qlever";
+    "Output format, valid values: nt, ttl, qlever, binary";
+
+const static inline std::string OUTPUT_GROUP_SUBJECTS_OPTION_SHORT = "";
+const static inline std::string OUTPUT_GROUP_SUBJECTS_OPTION_LONG =
+    "output-group-subjects";
+const static inline std::string OUTPUT_GROUP_SUBJECTS_OPTION_HELP =
+    "Write consecutive triples with the same subject as one statement "
+    "(s p1 o1 ; p2 o2 .), ignored for nt";
+const static inline std::string OUTPUT_GROUP_SUBJECTS_OPTION_INFO =
+    "Grouping triples by subject";
 
 const static inline std::string OUTPUT_KEEP_FILES_OPTION_SHORT = "";
 const static inline std::string OUTPUT_KEEP_FILES_OPTION_LONG =
@@ -82,6 +92,23 @@ const static inline std::string OUTPUT_COMPRESS_OPTION_LONG =
 const static inline std::string OUTPUT_COMPRESS_OPTION_HELP =
     "Output file compression, valid values: none, bz2, gz";
 
+const static inline std::string SPATIAL_RELATIONS_OUTPUT_INFO =
+    "Spatial relations output:";
+const static inline std::string SPATIAL_RELATIONS_OUTPUT_OPTION_SHORT = "";
+const static inline std::string SPATIAL_RELATIONS_OUTPUT_OPTION_LONG =
+    "spatial-relations-output";
+const static inline std::string SPATIAL_RELATIONS_OUTPUT_OPTION_HELP =
+    "Write spatial relation triples into this file instead of the output. The "
+    "output is closed before the spatial relations are calculated";
+
+const static inline std::string SPATIAL_RELATIONS_OUTPUT_COMPRESS_OPTION_SHORT =
+    "";
+const static inline std::string SPATIAL_RELATIONS_OUTPUT_COMPRESS_OPTION_LONG =
+    "spatial-relations-output-compression";
+const static inline std::string SPATIAL_RELATIONS_OUTPUT_COMPRESS_OPTION_HELP =
+    "Spatial relations output file compression, valid values: none, bz2, gz; "
+    "defaults to the output file compression";
+
 const static inline std::string STORE_LOCATIONS_INFO =
     "Storing locations osmium locations:";
 const static inline std::string STORE_LOCATIONS_SHORT = "";
@@ -301,16 +328,28 @@ const static inline std::string ADD_WAY_NODE_SPATIAL_METADATA_OPTION_LONG =
 const static inline std::string ADD_WAY_NODE_SPATIAL_METADATA_OPTION_HELP =
     "Add spatial information about the relations of member nodes in ways";
 
+const static inline std::string SKOLEMIZE_MEMBERS_INFO =
+    "Using IRIs instead of blank nodes for members of relations and ways";
+const static inline std::string SKOLEMIZE_MEMBERS_OPTION_SHORT = "";
+const static inline std::string SKOLEMIZE_MEMBERS_OPTION_LONG =
+    "skolemize-members";
+const static inline std::string SKOLEMIZE_MEMBERS_OPTION_HELP =
+    "Write members of relations and ways as IRIs derived from the parent ID "
+    "and the member position instead of blank nodes. The output of separate "
+    "or parallel runs can then be loaded without renaming blank nodes";
+
 const static inline std::string SIMPLIFY_GEOMETRIES_INFO =
-    "Simplifying relationship geometries with factor: ";
+    "Using simplified inner/outer geometries as pre-filter";
 const static inline std::string SIMPLIFY_GEOMETRIES_OPTION_SHORT = "";
 const static inline std::string SIMPLIFY_GEOMETRIES_OPTION_LONG =
     "simplify-geometries";
 const static inline std::string SIMPLIFY_GEOMETRIES_OPTION_HELP =
-    "Factor for geometry simplifaction, 0 to disable; will be multiplied with "
-    "the geometry "
-    "perimeter or length. This only affects "
-    "relationship calculations and not the geometry dump";
+    "Use conservative inner/outer simplified geometries of areas as a "
+    "pre-filter for the spatial relations. The inner/outer geometries are "
+    "built by spatialjoin, which derives the tolerance from each geometry. "
+    "The exact geometries are only checked if the simplified ones are "
+    "inconclusive. This only affects relationship calculations and not the "
+    "geometry dump";
 
 const static inline std::string SIMPLIFY_GEOMETRIES_INNER_OUTER_INFO =
     "Simplifying inner/outer geometries with factor: ";
@@ -367,7 +406,49 @@ const static inline std::string AUX_GEO_FILES_INFO =
 const static inline std::string AUX_GEO_FILES_OPTION_SHORT = "";
 const static inline std::string AUX_GEO_FILES_OPTION_LONG = "aux-geo-files";
 const static inline std::string AUX_GEO_FILES_OPTION_HELP =
-    "Auxiliary geo files for computing spatial relations";
+    "Auxiliary geo files for computing spatial relations, one geometry per "
+    "line as <id>\\t<WKT>";
+
+const static inline std::string AUX_GEO_FILES_CACHE_INFO =
+    "Caching auxiliary geo files as binary geometries";
+const static inline std::string AUX_GEO_FILES_CACHE_OPTION_SHORT = "";
+const static inline std::string AUX_GEO_FILES_CACHE_OPTION_LONG =
+    "aux-geo-files-cache";
+const static inline std::string AUX_GEO_FILES_CACHE_OPTION_HELP =
+    "Convert auxiliary WKT geo files into pre-projected binary geometry files "
+    "in the cache directory (suffix .o2rgeo) and load these on subsequent "
+    "runs. The "
+    "binary file is rebuilt if the WKT file is newer. Binary files can also "
+    "be passed to --aux-geo-files directly. Files with geometry types not "
+    "supported by the cache are read as WKT";
+
+const static inline std::string REDUCE_CONTAINS_INFO =
+    "Writing transitive reduction of contains relations";
+const static inline std::string REDUCE_CONTAINS_OPTION_SHORT = "";
+const static inline std::string REDUCE_CONTAINS_OPTION_LONG = "reduce-contains";
+const static inline std::string REDUCE_CONTAINS_OPTION_HELP =
+    "Only write direct contains relations: a contains relation is dropped if "
+    "it is implied by a chain of other contains relations";
+
+const static inline std::string SPATIAL_STRIPE_INFO =
+    "Computing spatial relations for longitude stripe: ";
+const static inline std::string SPATIAL_STRIPE_OPTION_SHORT = "";
+const static inline std::string SPATIAL_STRIPE_OPTION_LONG = "spatial-stripe";
+const static inline std::string SPATIAL_STRIPE_OPTION_HELP =
+    "Only compute spatial relations for longitude stripe I of N equally "
+    "wide stripes, given as I/N (0-based). Each relation is written by exactly "
+    "one stripe, facts and metadata are only written by stripe 0. Partial "
+    "outputs can be combined with --merge-spatial-stripes";
+
+const static inline std::string MERGE_SPATIAL_STRIPES_INFO =
+    "Merging partial stripe outputs";
+const static inline std::string MERGE_SPATIAL_STRIPES_OPTION_SHORT = "";
+const static inline std::string MERGE_SPATIAL_STRIPES_OPTION_LONG =
+    "merge-spatial-stripes";
+const static inline std::string MERGE_SPATIAL_STRIPES_OPTION_HELP =
+    "Concatenate the given partial outputs of --spatial-stripe runs (in the "
+    "given order) into the output file and exit. The partial outputs must "
+    "use the same format and compression.";
 
 const static inline std::string NUM_THREADS_INFO = "Number of threads to use";
 const static inline std::string NUM_THREADS_OPTION_SHORT = "";
@@ -20,6 +20,7 @@
 #ifndef OSM2RDF_OSM_AREA_H_
 #define OSM2RDF_OSM_AREA_H_
 
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -36,21 +37,23 @@ struct Area {
 
   Area();
   explicit Area(const osmium::Area& area);
+  // Rebuild for another area, reusing the allocated geometry storage.
+  void reset(const osmium::Area& area);
   // Osmium id.
   [[nodiscard]] id_t id() const noexcept;
   // OSM id.
   [[nodiscard]] id_t objId() const noexcept;
 
   [[nodiscard]] const ::util::geo::DMultiPolygon& geom() const noexcept;
-  [[nodiscard]] double geomArea() const noexcept;
   [[nodiscard]] const ::util::geo::DBox& envelope() const noexcept;
-  [[nodiscard]] ::util::geo::DPolygon convexHull() const noexcept;
-  [[nodiscard]] ::util::geo::DPolygon orientedBoundingBox() const noexcept;
-  [[nodiscard]] const ::util::geo::DPoint centroid() const noexcept;
+  // Derived geometries, computed on first access.
+  [[nodiscard]] double geomArea() const noexcept;
+  [[nodiscard]] const ::util::geo::DPolygon& convexHull() const noexcept;
+  [[nodiscard]] const ::util::geo::DPolygon& orientedBoundingBox()
+      const noexcept;
+  [[nodiscard]] const ::util::geo::DPoint& centroid() const noexcept;
   [[nodiscard]] bool fromWay() const noexcept;
   [[nodiscard]] bool hasName() const noexcept;
-  // finalize geometries
-  void finalize() noexcept;
 
   bool operator==(const osm2rdf::osm::Area& other) const noexcept;
   bool operator!=(const osm2rdf::osm::Area& other) const noexcept;
@@ -60,9 +63,12 @@ struct Area {
   id_t _id;
   // The OSM id
   id_t _objId;
-  double _geomArea = 0;
   ::util::geo::DMultiPolygon _geom;
   ::util::geo::DBox _envelope;
+  mutable std::optional<double> _geomArea;
+  mutable std::optional<::util::geo::DPoint> _centroid;
+  mutable std::optional<::util::geo::DPolygon> _convexHull;
+  mutable std::optional<::util::geo::DPolygon> _obb;
 };
 
 }  // namespace osm2rdf::osm
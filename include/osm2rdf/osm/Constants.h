@@ -19,6 +19,8 @@
 #ifndef OSM2RDF_OSM_CONSTANTS_H
 #define OSM2RDF_OSM_CONSTANTS_H
 
+#include <cstddef>
+
 namespace osm2rdf::osm::constants {
 
 static const int AREA_PRECISION = 4;
@@ -31,6 +33,9 @@ static const double INNER_OUTER_SIMPLIFICATION_FACTOR = 0.01;
 static const double DEGREE = 3.141592 / 180.0;
 static const double EARTH_RADIUS_KM = 6371.0;
 static const int METERS_IN_KM = 1000;
+
+// Maximum number of distinct tag keys cached per thread.
+static const size_t TAG_PREDICATE_CACHE_SIZE = 1 << 20;
 }  // namespace osm2rdf::osm::constants
 
 #endif  // OSM2RDF_OSM_CONSTANTS_H
@@ -20,7 +20,13 @@
 #ifndef OSM2RDF_OSM_FACTHANDLER_H_
 #define OSM2RDF_OSM_FACTHANDLER_H_
 
+#include <cstdint>
+#include <deque>
 #include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include "gtest/gtest_prod.h"
 #include "osm2rdf/config/Config.h"
@@ -31,14 +37,6 @@ namespace osm2rdf::osm {
 
 class LocationHandler;
 
-enum DateTimeType {
-  invalid = 0,
-  date_yyyy = 1,
-  date_yyyy_mm = 2,
-  date_yyyy_mm_dd = 3,
-  date_time = 4
-};
-
 template <typename W>
 class FactHandler {
  public:
@@ -62,12 +60,49 @@ class FactHandler {
   FRIEND_TEST(OSM_FactHandler, writeBoxPrecision1);
   FRIEND_TEST(OSM_FactHandler, writeBoxPrecision2);
 
+  // Write the WKT literal triple for a geometry directly into the output
+  // buffer, without building an intermediate string.
+  template <typename G>
+  void writeGeometryLiteral(const std::string& s, const std::string& p,
+                            const G& g);
+  void writeWKT(const ::util::geo::DPoint& point);
+  void writeWKT(const ::util::geo::DLine& line);
+  void writeWKT(const ::util::geo::DPolygon& polygon);
+  void writeWKT(const ::util::geo::DMultiPolygon& multiPolygon);
+  void writeWKT(const ::util::geo::DCollection& collection);
+  void writeWKTRing(const ::util::geo::DLine& ring, bool close);
+  void writeWKTRings(const ::util::geo::DPolygon& polygon);
+  void writeWKTCoordinate(double v);
+
   void writeMeta(const std::string& s, const osmium::Node& object);
 
   template <typename T>
   void writeMeta(const std::string& s, const T& object);
 
+  // Literal type a tag value is converted to, selected by its key.
+  enum class TagType : uint8_t { PLAIN, INTEGER, DATE, WIKIDATA, WIKIPEDIA };
+
+  struct TagInfo {
+    TagType type = TagType::PLAIN;
+    // Whether values are split at ';', see Config::semicolonTagKeys.
+    bool splitValues = false;
+    // Rendered predicate IRI, empty if the key can not be used in an IRI.
+    std::string predicate;
+    // Rendered osm2rdfkey: predicate for the converted value of DATE,
+    // WIKIDATA and WIKIPEDIA tags.
+    std::string typedPredicate;
+  };
+
+  // Renders the subject of the member at position pos of a way or relation
+  // into memberNode, reusing its capacity: a new blank node, or with
+  // skolemizeMembers the IRI osm2rdfmember:<base><pos>.
+  void generateMemberNode(std::string_view base, uint64_t pos,
+                          std::string* memberNode);
+  FRIEND_TEST(OSM_FactHandler, generateMemberNode);
+
   void writeTag(const std::string& s, const char* key, const char* val);
+  void writeTag(const std::string& s, const char* key, std::string_view val,
+                const TagInfo& tag);
   FRIEND_TEST(OSM_FactHandler, writeTag_AdminLevel);
   FRIEND_TEST(OSM_FactHandler, writeTag_AdminLevel_nonInteger);
   FRIEND_TEST(OSM_FactHandler, writeTag_AdminLevel_nonInteger2);
@@ -80,6 +115,17 @@ class FactHandler {
   FRIEND_TEST(OSM_FactHandler, writeTag_KeyIRI);
   FRIEND_TEST(OSM_FactHandler, writeTag_KeyNotIRI);
 
+  // Returns the type and the rendered predicates for the tag key. Results
+  // are cached per thread, so each distinct key is classified, checked and
+  // encoded only once.
+  const TagInfo& tagInfo(const char* key);
+  FRIEND_TEST(OSM_FactHandler, tagInfo);
+
+  // Write the typed osm2rdfkey: literal for a DATE tag, if the value is a
+  // valid date.
+  void writeDateTag(const std::string& s, const TagInfo& tag,
+                    std::string_view val);
+
   void writeTagList(const std::string& s, const osmium::TagList& tags);
   FRIEND_TEST(OSM_FactHandler, writeTagList);
   FRIEND_TEST(OSM_FactHandler, writeTagListWikidata);
@@ -116,8 +162,26 @@ class FactHandler {
   osm2rdf::osm::LocationHandler* _locationHandler;
   bool _separateUntaggedNodePrefixes = false;
   std::string _datasetId, _relNamespace, _wayNamespace, _changesetNamespace,
-      _iriXSDDouble, _iriWKTLiteral, _iriXSDInteger, _tagTripleCountIRI,
-      _areaIRI;
+      _iriXSDDouble, _iriXSDDecimal, _iriXSDYear, _iriXSDYearMonth,
+      _iriXSDDate, _iriWKTLiteral, _tagTripleCountIRI, _areaIRI,
+      _hasCompleteGeometryIRI, _relationMemberIRI, _tagKeyIRI, _tagValueIRI;
+  osm2rdf::ttl::PrefixId _relPrefix, _wayPrefix, _changesetPrefix,
+      _nodePrefix, _taggedNodePrefix, _untaggedNodePrefix, _tagPrefix,
+      _wikidataPrefix, _geomPrefix, _geosparqlPrefix, _memberPrefix = 0;
+
+  // Tag keys whose values are converted to typed literals. Add an entry here
+  // (and handle the type in writeTag or writeTagList) to type further keys.
+  // Wiki link keys are classified by their suffix in tagInfo.
+  std::unordered_map<std::string_view, TagType> _tagTypes;
+
+  struct TagInfoCache {
+    // Owns the keys referenced by infos.
+    std::deque<std::string> keys;
+    std::unordered_map<std::string_view, TagInfo> infos;
+    // Holds the last info once the cache is full.
+    TagInfo uncached;
+  };
+  std::vector<TagInfoCache> _tagInfos;
 };
 
 }  // namespace osm2rdf::osm
@@ -20,14 +20,18 @@
 #ifndef OSM2RDF_OSM_GEOMETRYHANDLER_H_
 #define OSM2RDF_OSM_GEOMETRYHANDLER_H_
 
+#include <filesystem>
 #include <iostream>
+#include <limits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "gtest/gtest_prod.h"
 #include "osm2rdf/config/Config.h"
 #include "osm2rdf/osm/Area.h"
+#include "osm2rdf/osm/Way.h"
 #include "osm2rdf/ttl/Writer.h"
 #include "osm2rdf/util/CacheFile.h"
 #include "osm2rdf/util/DirectedGraph.h"
@@ -49,10 +53,10 @@ class GeometryHandler {
   ~GeometryHandler();
 
   // Add data
-  void area(const osm2rdf::osm::Area& area);
+  void area(const osmium::Area& area);
   void node(const osmium::Node& node);
   void relation(const osm2rdf::osm::Relation& relation);
-  void way(const osm2rdf::osm::Way& way);
+  void way(const osmium::Way& way);
 
   // Calculate data
   void calculateRelations();
@@ -73,19 +77,58 @@ class GeometryHandler {
 
   static ::util::geo::I32Box transform(const ::util::geo::DBox& box);
 
-  static ::util::geo::I32Line transform(const ::util::geo::DLine& way);
-  static ::util::geo::I32MultiPolygon transform(
-      const ::util::geo::DMultiPolygon& area);
+  // Project the locations of nodes directly into out, using lngLat as
+  // scratch space. Reuses the storage of both vectors.
+  static void transform(const osmium::NodeRefList& nodes, bool skipInvalid,
+                        std::vector<double>* lngLat,
+                        ::util::geo::I32Line* out);
+
+  // Per-thread buffers for the geometries passed to the sweeper, reused for
+  // every way and area.
+  struct GeometryBuffer {
+    std::vector<double> lngLat;
+    ::util::geo::I32Line line;
+    ::util::geo::I32MultiPolygon multiPolygon;
+  };
+  std::vector<GeometryBuffer> _geomBuffers;
+
+  // Parse the given auxiliary WKT files. Files are memory mapped and split
+  // at line boundaries into chunks which are parsed in parallel.
+  void addAuxWKTFiles(const std::vector<std::string>& files);
+
+  // Add all geometries of a binary auxiliary geo cache file, in parallel.
+  void addAuxGeoCache(const std::filesystem::path& path);
+
+  // Check whether the box of the geometry with the given id intersects the
+  // configured longitude stripe, remembers geometries reaching over the left
+  // stripe border for deduplication. Always true if no stripe is configured.
+  bool inStripe(const ::util::geo::I32Box& box, const std::string& id);
 
   std::string getSweeperId(uint64_t oid, char type);
   std::string getFullID(const char* id, size_t n);
 
   void writeRelCb(size_t t, const char* a, size_t an, const char* b, size_t bn,
                   const char* pred, size_t predn);
+
+  // Encode a sweeper id as (oid << 3) | type, false if not possible.
+  static bool getContainsKey(const char* id, size_t n, uint64_t* key);
+  // Write the transitive reduction of the collected contains relations.
+  void writeReducedContains();
   void progressCb(size_t progr);
 
   osm2rdf::util::ProgressBar _progressBar;
   bool _separateUntaggedNodePrefixes = false;
+
+  // Longitude stripe [_stripeMinX, _stripeMaxX) in web mercator coordinates.
+  bool _striped = false;
+  int32_t _stripeMinX = std::numeric_limits<int32_t>::min();
+  int32_t _stripeMaxX = std::numeric_limits<int32_t>::max();
+  // Ids of geometries starting left of the stripe, per thread.
+  std::vector<std::unordered_set<std::string>> _stripeLeftIds;
+
+  // Contains relations as (container, contained) keys, per thread. Only
+  // collected with --reduce-contains.
+  std::vector<std::vector<std::pair<uint64_t, uint64_t>>> _containsEdges;
 };
 
 }  // namespace osm2rdf::osm
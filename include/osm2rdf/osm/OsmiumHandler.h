@@ -20,9 +20,14 @@
 #ifndef OSM2RDF_OSM_OSMIUMHANDLER_H
 #define OSM2RDF_OSM_OSMIUMHANDLER_H
 
+#include <vector>
+
 #include "osm2rdf/config/Config.h"
+#include "osm2rdf/osm/Area.h"
 #include "osm2rdf/osm/FactHandler.h"
 #include "osm2rdf/osm/GeometryHandler.h"
+#include "osm2rdf/osm/Relation.h"
+#include "osm2rdf/osm/Way.h"
 #include "osm2rdf/ttl/Writer.h"
 #include "osm2rdf/util/ProgressBar.h"
 #include "osmium/area/assembler.hpp"
@@ -84,6 +89,12 @@ class OsmiumHandler : public osmium::handler::Handler {
 
   std::atomic<size_t> _numTasksDone = 0;
 
+  // Per-thread objects which are reset for each handled OSM object, so
+  // that their geometry storage is reused instead of reallocated.
+  std::vector<osm2rdf::osm::Area> _areas;
+  std::vector<osm2rdf::osm::Relation> _relations;
+  std::vector<osm2rdf::osm::Way> _ways;
+
  private:
   void handleBuffers(
       osmium::memory::Buffer& buffer,
@@ -19,6 +19,7 @@
 #ifndef OSM2RDF_OSM_RELATION_H_
 #define OSM2RDF_OSM_RELATION_H_
 
+#include <optional>
 #include <vector>
 
 #include "RelationHandler.h"
@@ -35,6 +36,10 @@ class Relation {
   typedef uint32_t id_t;
   Relation();
   explicit Relation(const osmium::Relation& relation);
+  // Reset to another relation. Keeps the capacity of the collection and of
+  // the scratch line used for way members. The collection's elements own
+  // their coordinates and are rebuilt for every relation.
+  void reset(const osmium::Relation& relation);
   [[nodiscard]] id_t id() const noexcept;
   [[nodiscard]] osm2rdf::osm::generic::changeset_id_t changeset() const noexcept;
   [[nodiscard]] std::time_t timestamp() const noexcept;
@@ -49,11 +54,24 @@ class Relation {
   [[nodiscard]] bool isArea() const noexcept;
   [[nodiscard]] bool hasGeometry() const noexcept;
   [[nodiscard]] const ::util::geo::DCollection& geom() const noexcept;
+  [[nodiscard]] const ::util::geo::DBox& envelope() const noexcept;
+  // Derived geometries, computed on first access.
+  [[nodiscard]] const ::util::geo::DPoint& centroid() const noexcept;
+  [[nodiscard]] const ::util::geo::DPolygon& convexHull() const noexcept;
+  [[nodiscard]] const ::util::geo::DPolygon& orientedBoundingBox()
+      const noexcept;
   void buildGeometry(osm2rdf::osm::RelationHandler& relationHandler);
 
  protected:
   const osmium::Relation* _r = 0;
   ::util::geo::DCollection _geom;
+  // Scratch buffer for building way members, reused across relations.
+  ::util::geo::DLine _wayLine;
+  // Bounding box of _geom, built together with it.
+  ::util::geo::DBox _envelope;
+  mutable std::optional<::util::geo::DPoint> _centroid;
+  mutable std::optional<::util::geo::DPolygon> _convexHull;
+  mutable std::optional<::util::geo::DPolygon> _obb;
   bool _hasCompleteGeometry;
   bool _isArea;
 };
@@ -19,6 +19,7 @@
 #ifndef OSM2RDF_OSM_WAY_H_
 #define OSM2RDF_OSM_WAY_H_
 
+#include <optional>
 #include <vector>
 
 #include "osm2rdf/osm/Box.h"
@@ -33,6 +34,8 @@ class Way {
   typedef uint32_t id_t;
   Way();
   explicit Way(const osmium::Way& way);
+  // Rebuild for another way, reusing the allocated geometry storage.
+  void reset(const osmium::Way& way);
   [[nodiscard]] id_t id() const noexcept;
   [[nodiscard]] osm2rdf::osm::generic::changeset_id_t changeset() const noexcept;
   [[nodiscard]] std::time_t timestamp() const noexcept;
@@ -42,12 +45,29 @@ class Way {
   [[nodiscard]] bool visible() const noexcept;
   [[nodiscard]] bool closed() const noexcept;
   [[nodiscard]] bool isArea() const noexcept;
-  [[nodiscard]] const ::util::geo::DLine geom() const noexcept;
+  // Same checks as above, without building the geometry of the way.
+  [[nodiscard]] static bool closed(const osmium::Way& way) noexcept;
+  [[nodiscard]] static bool isArea(const osmium::Way& way) noexcept;
+  [[nodiscard]] const ::util::geo::DLine& geom() const noexcept;
+  [[nodiscard]] const ::util::geo::DBox& envelope() const noexcept;
+  // Derived geometries, computed on first access.
+  [[nodiscard]] double length() const noexcept;
+  [[nodiscard]] const ::util::geo::DPoint& centroid() const noexcept;
+  [[nodiscard]] const ::util::geo::DPolygon& convexHull() const noexcept;
+  [[nodiscard]] const ::util::geo::DPolygon& orientedBoundingBox()
+      const noexcept;
   [[nodiscard]] const osmium::WayNodeList& nodes() const noexcept;
   [[nodiscard]] const osmium::TagList& tags() const noexcept;
 
  protected:
   const osmium::Way* _w = 0;
+  // Geometry without invalid and repeated locations, built once.
+  ::util::geo::DLine _geom;
+  ::util::geo::DBox _envelope;
+  mutable std::optional<double> _length;
+  mutable std::optional<::util::geo::DPoint> _centroid;
+  mutable std::optional<::util::geo::DPolygon> _convexHull;
+  mutable std::optional<::util::geo::DPolygon> _obb;
 };
 
 }  // namespace osm2rdf::osm
@@ -0,0 +1,91 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef OSM2RDF_TTL_BINARY_H_
+#define OSM2RDF_TTL_BINARY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace osm2rdf::ttl::binary {
+
+// Triple stream written by Writer<format::BINARY>. Integers are unsigned
+// LEB128 varints, strings are a varint length followed by the raw UTF-8
+// bytes, nothing is escaped. The stream is a sequence of records, each
+// starting with a Record tag:
+//   MAGIC   followed by the remaining bytes of MAGIC, starts a stream. The
+//           outputs of several runs can be concatenated.
+//   PREFIX  varint prefix id, string IRI
+//   TRIPLE  subject, predicate and object term
+// Terms start with a Term tag:
+//   IRI            string IRI
+//   PREFIXED       varint prefix id, string local part
+//   PREFIXED_ID    varint prefix id, varint id written as decimal local part
+//   BLANK_NODE     string label without "_:"
+//   LITERAL        string lexical form (xsd:string)
+//   TYPED_LITERAL  string lexical form, datatype as IRI, PREFIXED or
+//                  PREFIXED_ID term
+//   LANG_LITERAL   string lexical form, string language tag
+//   INTEGER        zigzag encoded varint (xsd:integer)
+//   NT             string N-Triples term which could not be split up
+enum class Record : uint8_t { MAGIC = 0, PREFIX = 1, TRIPLE = 2 };
+
+enum class Term : uint8_t {
+  IRI = 0,
+  PREFIXED = 1,
+  PREFIXED_ID = 2,
+  BLANK_NODE = 3,
+  LITERAL = 4,
+  TYPED_LITERAL = 5,
+  LANG_LITERAL = 6,
+  INTEGER = 7,
+  NT = 8
+};
+
+// Record::MAGIC followed by the format version.
+const static inline std::string MAGIC = std::string(1, '\0') + "O2RBIN1";
+
+// Maximal number of bytes of a varint.
+const static size_t MAX_VARINT_LENGTH = 10;
+
+// Writes v as varint into buf, returns the number of bytes written.
+inline size_t encodeVarint(uint64_t v, char* buf) {
+  size_t n = 0;
+  while (v >= 0x80) {
+    buf[n++] = static_cast<char>((v & 0x7F) | 0x80);
+    v >>= 7;
+  }
+  buf[n++] = static_cast<char>(v);
+  return n;
+}
+
+// Maps signed to unsigned integers so that small magnitudes have short
+// varints: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+inline uint64_t encodeZigZag(int64_t v) {
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+inline int64_t decodeZigZag(uint64_t v) {
+  return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+}
+
+}  // namespace osm2rdf::ttl::binary
+
+#endif  // OSM2RDF_TTL_BINARY_H_
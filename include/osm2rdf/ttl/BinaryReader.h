@@ -0,0 +1,94 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef OSM2RDF_TTL_BINARYREADER_H_
+#define OSM2RDF_TTL_BINARYREADER_H_
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "osm2rdf/ttl/Binary.h"
+#include "osm2rdf/ttl/Format.h"
+#include "osm2rdf/ttl/Writer.h"
+
+namespace osm2rdf::ttl {
+
+// A term read from a binary stream. The views stay valid until the next call
+// of BinaryReader::next.
+struct BinaryTerm {
+  binary::Term type = binary::Term::NT;
+  // IRI of the prefix of PREFIXED and PREFIXED_ID terms.
+  std::string_view prefix;
+  // IRI, local part (the decimal id for PREFIXED_ID), blank node label,
+  // lexical form or N-Triples term.
+  std::string_view value;
+  // Full datatype IRI of TYPED_LITERAL terms.
+  std::string_view datatype;
+  // Language tag of LANG_LITERAL terms.
+  std::string_view lang;
+  uint64_t id = 0;
+  int64_t integer = 0;
+};
+
+// Reads the triple stream written by Writer<format::BINARY>, see Binary.h.
+class BinaryReader {
+ public:
+  explicit BinaryReader(std::istream* in);
+
+  // Reads the next triple, prefix records are consumed on the way. Returns
+  // false at the end of the stream and throws std::runtime_error if the
+  // stream is malformed.
+  bool next();
+  // Subject (0), predicate (1) or object (2) of the current triple.
+  [[nodiscard]] const BinaryTerm& term(size_t i) const;
+
+  // Writes the current triple with the N-Triples writer.
+  void writeTriple(Writer<format::NT>* writer, size_t part) const;
+
+  // Converts the binary stream in into N-Triples written with writer.
+  // Returns the number of triples.
+  static size_t convert(std::istream* in, Writer<format::NT>* writer);
+
+ protected:
+  uint8_t readByte();
+  uint64_t readVarint();
+  void readString(std::string* buf);
+  // Reads an IRI, PREFIXED or PREFIXED_ID term as full IRI into buf.
+  void readIRI(std::string* buf);
+  void readTerm(size_t i);
+  [[nodiscard]] const std::string& prefix(uint64_t id) const;
+  static void writeTerm(const BinaryTerm& term, Writer<format::NT>* writer,
+                        size_t part);
+
+  std::istream* _in;
+  bool _hasMagic = false;
+  std::vector<std::string> _prefixes;
+  std::array<BinaryTerm, 3> _terms;
+  // Storage of the term values.
+  std::array<std::string, 3> _values;
+  std::array<std::string, 3> _extras;
+};
+
+}  // namespace osm2rdf::ttl
+
+#endif  // OSM2RDF_TTL_BINARYREADER_H_
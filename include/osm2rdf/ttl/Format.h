@@ -26,6 +26,7 @@ namespace osm2rdf::ttl::format {
 struct QLEVER {};
 struct TTL {};
 struct NT {};
+struct BINARY {};
 }  // namespace osm2rdf::ttl::format
 
 #endif  // OSM2RDF_TTL_OUTPUTFORMAT_H_
@@ -75,7 +75,13 @@ static const int MASK_BITS_OF_ONE_BYTE = k0xFF;
 
 static const int UTF8_BYTES_LONG = 8;
 static const int UTF8_BYTES_SHORT = 4;
+#include <charconv>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 #include "gtest/gtest_prod.h"
 #include "osm2rdf/config/Config.h"
@@ -84,11 +90,40 @@ static const int UTF8_BYTES_SHORT = 4;
 #include "osm2rdf/osm/Relation.h"
 #include "osm2rdf/osm/Tag.h"
 #include "osm2rdf/osm/Way.h"
+#include "osm2rdf/ttl/Binary.h"
 #include "osm2rdf/ttl/Constants.h"
 #include "osm2rdf/util/Output.h"
+#include "osm2rdf/util/Time.h"
 
 namespace osm2rdf::ttl {
 
+// Handle of a prefix known to a Writer, see Writer::prefixId.
+typedef uint16_t PrefixId;
+
+// Handle of a blank node, see Writer::newBlankNode. The label "_:<t>_<n>" is
+// rendered once as digits into an inline buffer and converts to a
+// std::string_view, so it can be passed to all write functions without
+// building a std::string.
+class BlankNode {
+ public:
+  BlankNode() = default;
+  BlankNode(uint64_t thread, uint64_t count) {
+    char* c = _label;
+    *c++ = '_';
+    *c++ = ':';
+    c = std::to_chars(c, _label + sizeof(_label), thread).ptr;
+    *c++ = '_';
+    c = std::to_chars(c, _label + sizeof(_label), count).ptr;
+    _length = static_cast<uint8_t>(c - _label);
+  }
+  operator std::string_view() const { return {_label, _length}; }
+
+ private:
+  // "_:", two uint64_t and "_"
+  char _label[43];
+  uint8_t _length = 0;
+};
+
 template <typename T>
 class Writer {
  public:
@@ -98,7 +133,8 @@ class Writer {
   // Write statistic json into output.
   void writeStatisticJson(const std::filesystem::path& output);
 
-  // Write the header (does nothing for NT)
+  // Write the header (does nothing for NT, writes the magic and the prefix
+  // records for BINARY)
   void writeHeader();
 
   // Write metadata about used osm2rdf options, version, and dump date.
@@ -109,10 +145,61 @@ class Writer {
                          const std::string& value);
 
   // Write a single RDF line. The contents of s, p, and o are not checked.
-  void writeTriple(const std::string& s, const std::string& p,
-                   const std::string& o);
-  void writeTriple(const std::string& s, const std::string& p,
-                   const std::string& o, size_t part);
+  void writeTriple(std::string_view s, std::string_view p, std::string_view o);
+  void writeTriple(std::string_view s, std::string_view p, std::string_view o,
+                   size_t part);
+
+  // Streaming triple emission: writeTripleStart writes the already formatted
+  // subject s and predicate p, the object is then written with one of the
+  // write* functions and writeTripleEnd closes the triple. Nothing is copied
+  // into intermediate strings.
+  void writeTripleStart(std::string_view s, std::string_view p);
+  void writeTripleStart(std::string_view s, std::string_view p, size_t part);
+  void writeTripleEnd();
+  void writeTripleEnd(size_t part);
+
+  // Terminate the statements left open by outputGroupSubjects, in which
+  // consecutive triples of a part with the same subject are written as
+  // "s p1 o1 ;\n\tp2 o2 .". Has to be called before the output is closed,
+  // does nothing otherwise.
+  void closeStatements();
+
+  // Write a single RDF line with the IRI build from prefix and id as object.
+  void writeIRITriple(std::string_view s, std::string_view p,
+                      std::string_view prefix, uint64_t id);
+  void writeIRITriple(std::string_view s, std::string_view p,
+                      std::string_view prefix, uint64_t id, size_t part);
+  void writeIRITriple(std::string_view s, std::string_view p, PrefixId prefix,
+                      uint64_t id);
+  void writeIRITriple(std::string_view s, std::string_view p, PrefixId prefix,
+                      uint64_t id, size_t part);
+
+  // Write a single RDF line with the IRI build from the known prefix and the
+  // "safe" local part v as object.
+  void writeIRITripleUnsafe(std::string_view s, std::string_view p,
+                            PrefixId prefix, std::string_view v);
+  void writeIRITripleUnsafe(std::string_view s, std::string_view p,
+                            PrefixId prefix, std::string_view v, size_t part);
+
+  // Write a single RDF line with the IRIREF of the concatenated, encoded
+  // parts as object.
+  void writeIRIREFTriple(std::string_view s, std::string_view p,
+                         std::initializer_list<std::string_view> parts);
+  void writeIRIREFTriple(std::string_view s, std::string_view p,
+                         std::initializer_list<std::string_view> parts,
+                         size_t part);
+
+  // Write a single RDF line with the escaped literal v as object.
+  void writeLiteralTriple(std::string_view s, std::string_view p,
+                          std::string_view v);
+  void writeLiteralTriple(std::string_view s, std::string_view p,
+                          std::string_view v, size_t part);
+
+  // Write a single RDF line with v as xsd:integer literal object.
+  void writeIntegerLiteralTriple(std::string_view s, std::string_view p,
+                                 int64_t v);
+  void writeIntegerLiteralTriple(std::string_view s, std::string_view p,
+                                 int64_t v, size_t part);
 
   void writeIRILiteralTriple(const std::string& s, const std::string& p,
                              const std::string& v, const std::string& o);
@@ -125,13 +212,15 @@ class Writer {
   void writeUnsafeIRILiteralTriple(const char* s, const char* p,
                                    const char* v, const char* o,
                                    size_t part);
+  void writeUnsafeIRILiteralTriple(std::string_view s, PrefixId p,
+                                   std::string_view v, std::string_view o);
 
   // Write a single RDF line with a literal. The contents of s, p, a and b are
   // not checked.
-  void writeLiteralTripleUnsafe(const std::string& s, const std::string& p,
-                                const std::string& a, const std::string& b);
-  void writeLiteralTripleUnsafe(const std::string& s, const std::string& p,
-                                const std::string& a, const std::string& b,
+  void writeLiteralTripleUnsafe(std::string_view s, std::string_view p,
+                                std::string_view a, std::string_view b);
+  void writeLiteralTripleUnsafe(std::string_view s, std::string_view p,
+                                std::string_view a, std::string_view b,
                                 size_t part);
 
   // write a string_view directly to the output
@@ -164,17 +253,33 @@ class Writer {
   // resolvePrefix resolves the given prefix. If the prefix is unknown it is
   // returned as provided.
   std::string resolvePrefix(std::string_view p);
+  // prefixId returns the handle of the known prefix p. Throws
+  // std::out_of_range if the prefix is unknown.
+  PrefixId prefixId(std::string_view p) const;
 
   // generateBlankNode creates a new unique identifier for a blank node.
   std::string generateBlankNode();
+  // newBlankNode creates a handle for a new unique blank node.
+  BlankNode newBlankNode();
 
   // Creates a IRI from given prefix p and string value v.
   // Assumes that both p and v are "safe", that is, they can be used
   // directly in the TTL
   std::string generateIRIUnsafe(std::string_view p, std::string_view v);
 
+  // Renders the IRI from the known prefix p and the local part v followed by
+  // the ID id into buf, reusing its capacity. Assumes that v is "safe". For
+  // BINARY, buf holds the already encoded term, which is only valid as
+  // argument of the write functions.
+  void generateIRIUnsafe(PrefixId p, std::string_view v, uint64_t id,
+                         std::string* buf);
+  std::string generateIRIUnsafe(PrefixId p, std::string_view v, uint64_t id);
+
   // generateIRI creates a IRI from given prefix p and ID value v.
   std::string generateIRI(std::string_view p, uint64_t v);
+  // generateIRI creates a IRI from the known prefix p and ID value v, see
+  // generateIRIUnsafe for BINARY.
+  std::string generateIRI(PrefixId p, uint64_t v);
   // generateIRI creates a IRI from given prefix p and string value v.
   std::string generateIRI(std::string_view p, std::string_view v);
 
@@ -183,8 +288,13 @@ class Writer {
   // directly in the TTL
   void writeIRIUnsafe(std::string_view p, std::string_view v, size_t part);
 
+  // Writes an IRI from given known prefix p and string value v. Assumes that v
+  // is "safe".
+  void writeIRIUnsafe(PrefixId p, std::string_view v, size_t part);
+
   // Writes  a IRI from given prefix p and ID value v.
   void writeIRI(std::string_view p, uint64_t v, size_t part);
+  void writeIRI(PrefixId p, uint64_t v, size_t part);
   // Writes a IRI from given prefix p and string value v.
   void writeIRI(std::string_view p, std::string_view v, size_t part);
 
@@ -200,6 +310,16 @@ class Writer {
   std::string generateLiteralUnsafe(std::string_view v, std::string_view s);
 
   void writeLiteral(std::string_view v, size_t part);
+  // Streaming literal: writeLiteralStart opens the literal, its lexical form
+  // is then written with write() and writeLiteralEnd closes it with the
+  // datatype IRI from the known prefix p and the "safe" local part v. The
+  // lexical form is not escaped.
+  void writeLiteralStart();
+  void writeLiteralStart(size_t part);
+  void writeLiteralEnd(PrefixId p, std::string_view v);
+  void writeLiteralEnd(PrefixId p, std::string_view v, size_t part);
+  // Writes v as xsd:integer literal.
+  void writeIntegerLiteral(int64_t v, size_t part);
   void writeLiteralUnsafe(std::string_view v, std::string_view s, size_t part);
 
   void writeSecondsAsISO(const std::string& subj, const std::string& pred,
@@ -236,6 +356,11 @@ class Writer {
 
   void writePrefixedNameUnsafe(std::string_view p, std::string_view v,
                                size_t part);
+  void writeIRIREFUnsafe(std::string_view p, std::string_view v, size_t part);
+  // Writes the IRIREF of the concatenated parts, encoded like IRIREF, without
+  // building intermediate strings.
+  void writeIRIREF(std::initializer_list<std::string_view> parts, size_t part);
+  void writeEncodedIRIREF(std::string_view s, size_t part);
   void writePrefixedName(std::string_view p, std::string_view v, size_t part);
 
   std::string encodeIRIREF(std::string_view s);
@@ -281,7 +406,48 @@ class Writer {
   const osm2rdf::config::Config _config;
 
   // Prefix
-  std::unordered_map<std::string, std::string> _prefixes;
+  struct Prefix {
+    std::string name;
+    std::string iri;
+    // Pre-rendered bytes written before and after the local part of an IRI
+    // with this prefix.
+    std::string begin;
+    std::string end;
+  };
+  void renderPrefix(Prefix* prefix);
+  const Prefix* findPrefix(std::string_view p) const;
+
+  // Write the subject s followed by a space, or only continue the open
+  // statement of part if triples are grouped and it has subject s.
+  void writeSubject(std::string_view s, size_t part);
+  // Write the already formatted term t. BINARY splits it up into a term of
+  // the binary format, see Binary.h.
+  void writeTerm(std::string_view t, size_t part);
+  // Write the separator between the terms of a triple.
+  void writeSeparator(size_t part);
+
+  // Building blocks of the binary format.
+  void writeVarint(uint64_t v, size_t part);
+  void writeBinaryString(std::string_view s, size_t part);
+  void writeBinaryTag(binary::Term tag, size_t part);
+  // Write the IRI as PREFIXED or PREFIXED_ID term if it starts with a known
+  // prefix, using the longest one, as IRI otherwise.
+  void writeBinaryIRI(std::string_view iri, size_t part);
+  // Write the literal with lexical form v and the formatted suffix, i.e.
+  // "^^<datatype>", "@lang" or "". Returns false if the suffix is unknown.
+  bool writeBinaryLiteral(std::string_view v, std::string_view suffix,
+                          size_t part);
+  // Replace the ECHAR and UCHAR escape sequences of an NT term by the raw
+  // UTF-8 bytes. Returns false if s contains an invalid escape sequence.
+  bool unescapeTerm(std::string_view s, std::string* res);
+
+  // Deque to keep the names referenced by _prefixIds stable.
+  std::deque<Prefix> _prefixes;
+  std::unordered_map<std::string_view, PrefixId> _prefixIds;
+  // Prefix IRIs to their ids, used to split up IRIs for BINARY.
+  std::unordered_map<std::string_view, PrefixId> _prefixIriIds;
+  // Distinct last characters of all prefix IRIs, the candidate split points.
+  std::string _prefixIriEnds;
 
   // Output
   osm2rdf::util::Output* _out;
@@ -290,6 +456,20 @@ class Writer {
   uint64_t* _blankNodeCount;
   uint64_t* _headerLines;
   uint64_t* _lineCount;
+  osm2rdf::util::ISOTimeFormatter* _timeFormatters;
+
+  // Subject grouping, _openSubjects holds the subject of the open statement
+  // of each part and is empty if there is none.
+  bool _groupSubjects;
+  std::string* _openSubjects;
+
+  // Raw object of the current triple of each part written with write(), only
+  // used by BINARY where terms are length prefixed.
+  std::string* _rawObjects;
+
+  // Prefix of the datatype written by writeSecondsAsISO.
+  PrefixId _xsdPrefix;
+
   // Number of parts.
   std::size_t _numOuts;
 };
@@ -0,0 +1,130 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef OSM2RDF_UTIL_AUXGEOCACHE_H_
+#define OSM2RDF_UTIL_AUXGEOCACHE_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "util/geo/Geo.h"
+
+namespace osm2rdf::util {
+
+enum class AuxGeoType : uint8_t { POINT = 1, LINE = 2, MULTIPOLYGON = 3 };
+
+// Binary, memory mapped cache of auxiliary geometries already projected to
+// integer web mercator coordinates.
+//
+// Layout (native byte order):
+//   char[8]  magic
+//   uint64   number of records
+//   uint64   offset of the record offset table
+//   records: uint8 type, uint32 id length, id bytes, geometry
+//   uint64[] record offsets
+// Geometries are stored as a point (int32 x, int32 y), a line (uint32 number
+// of points, points) or a multipolygon (uint32 number of polygons, for each
+// polygon uint32 number of rings followed by the rings as lines, outer ring
+// first).
+class AuxGeoCache {
+ public:
+  // Maps the cache file at path into memory.
+  explicit AuxGeoCache(const std::filesystem::path& path);
+  // Unmaps the cache file.
+  ~AuxGeoCache();
+  AuxGeoCache(const AuxGeoCache&) = delete;
+  AuxGeoCache& operator=(const AuxGeoCache&) = delete;
+
+  // Number of geometries in the cache.
+  [[nodiscard]] size_t size() const;
+  // Access the i-th geometry, the accessor must match type(i).
+  [[nodiscard]] AuxGeoType type(size_t i) const;
+  [[nodiscard]] std::string_view id(size_t i) const;
+  [[nodiscard]] ::util::geo::I32Point point(size_t i) const;
+  [[nodiscard]] ::util::geo::I32Line line(size_t i) const;
+  [[nodiscard]] ::util::geo::I32MultiPolygon multiPolygon(size_t i) const;
+
+  // Check whether the file at path is an auxiliary geometry cache.
+  static bool isCacheFile(const std::filesystem::path& path);
+
+  // Path of the cache file for the WKT file at wktPath inside cacheDir,
+  // unique for each absolute WKT path.
+  static std::filesystem::path cachePath(const std::filesystem::path& cacheDir,
+                                         const std::filesystem::path& wktPath);
+
+  // Convert a WKT file with lines "<id>\t<WKT>" into a cache file, projecting
+  // each coordinate with project. Supports POINT, LINESTRING, POLYGON and
+  // MULTIPOLYGON, other types and trailing characters after a geometry
+  // throw. Lines without an id are rejected. Returns the number of converted
+  // geometries.
+  static size_t convert(
+      const std::filesystem::path& wktPath,
+      const std::filesystem::path& cachePath,
+      const std::function<::util::geo::I32Point(const ::util::geo::DPoint&)>&
+          project);
+
+  // Sequentially writes a cache file. The data is written to a temporary
+  // file next to path, which is renamed to path on close.
+  class Writer {
+   public:
+    explicit Writer(const std::filesystem::path& path);
+    ~Writer();
+    void add(std::string_view id, const ::util::geo::I32Point& point);
+    void add(std::string_view id, const ::util::geo::I32Line& line);
+    void add(std::string_view id, const ::util::geo::I32MultiPolygon& mp);
+    // Writes the offset table and header. A cache file which was not closed
+    // is not recognized as a cache file.
+    void close();
+
+   protected:
+    void writeHeader(std::string_view id, AuxGeoType type);
+    void writeLine(const ::util::geo::I32Line& line);
+    template <typename T>
+    void writeValue(T value);
+
+    std::filesystem::path _path;
+    std::filesystem::path _tmpPath;
+    std::ofstream _out;
+    std::vector<uint64_t> _offsets;
+    uint64_t _pos = 0;
+  };
+
+  static const inline std::string MAGIC = "O2RGEO01";
+
+ protected:
+  [[nodiscard]] const char* record(size_t i) const;
+  [[nodiscard]] const char* idEnd(size_t i) const;
+  static const char* readLine(const char* c, ::util::geo::I32Line* line);
+  // Check that the i-th record lies completely before end.
+  [[nodiscard]] bool validRecord(size_t i, const char* end) const;
+
+  int _fd = -1;
+  char* _data = nullptr;
+  size_t _dataSize = 0;
+  uint64_t _size = 0;
+  const char* _offsets = nullptr;
+};
+
+}  // namespace osm2rdf::util
+
+#endif  // OSM2RDF_UTIL_AUXGEOCACHE_H_
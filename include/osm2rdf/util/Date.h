@@ -0,0 +1,50 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef OSM2RDF_UTIL_DATE_H_
+#define OSM2RDF_UTIL_DATE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace osm2rdf::util {
+
+enum class DateType : uint8_t {
+  INVALID = 0,
+  YEAR = 1,
+  YEAR_MONTH = 2,
+  DATE = 3
+};
+
+// Buffer size sufficient for every output of normalizeDate.
+const static size_t DATE_BUFFER_SIZE = 16;
+
+// Normalize an OSM date value "[-]Y[-M[-D]]" to the lexical form of
+// xsd:gYear, xsd:gYearMonth or xsd:date in a single pass over v: the year is
+// zero padded to (or cut after its first) 4 significant digits, month and
+// day are zero padded to 2 digits. Values with other chars than digits and
+// '-', without any digit, with more than 3 components or with a month
+// outside 1-12 or a day outside 1-31 are INVALID. Writes the result into buf
+// and its length into len, buf is not null terminated.
+DateType normalizeDate(std::string_view v, char* buf, size_t* len);
+
+}  // namespace osm2rdf::util
+
+#endif  // OSM2RDF_UTIL_DATE_H_
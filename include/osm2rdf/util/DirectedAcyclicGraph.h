@@ -20,87 +20,172 @@
 #define OSM2RDF_UTIL_DIRECTEDACYLICGRAPH_H
 
 #include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
 
 #include "DirectedGraph.h"
 #include "ProgressBar.h"
+#if defined(_OPENMP)
+#include "omp.h"
+#endif
 
 namespace osm2rdf::util {
 
-// reduceDAG returns a reduced DAG from a given sorted DAG
+namespace detail {
+
+// Keep all edges of src whose target is not marked in visited, marks are
+// removed afterwards. Edges are written in ascending order into out.
+template <typename T>
+void keepUnmarkedEdges(const osm2rdf::util::DirectedGraph<T>& dag,
+                       typename DirectedGraph<T>::index_t src,
+                       std::vector<uint64_t>* visited,
+                       std::vector<typename DirectedGraph<T>::index_t>* marked,
+                       std::vector<std::pair<T, T>>* out) {
+  std::vector<typename DirectedGraph<T>::index_t> direct(dag.edgesBegin(src),
+                                                         dag.edgesEnd(src));
+  std::sort(direct.begin(), direct.end());
+  direct.erase(std::unique(direct.begin(), direct.end()), direct.end());
+  for (const auto& dst : direct) {
+    if (!((*visited)[dst / 64] & (1ULL << (dst % 64)))) {
+      out->emplace_back(dag.getVertex(src), dag.getVertex(dst));
+    }
+  }
+  for (const auto& i : *marked) {
+    (*visited)[i / 64] = 0;
+  }
+  marked->clear();
+}
+
+// Build a graph from the per thread edge lists, each source vertex was handled
+// by exactly one thread.
+template <typename T>
+osm2rdf::util::DirectedGraph<T> fromEdges(
+    std::vector<std::vector<std::pair<T, T>>>* edges) {
+  osm2rdf::util::DirectedGraph<T> result;
+  std::vector<std::pair<T, T>> all;
+  size_t n = 0;
+  for (const auto& e : *edges) n += e.size();
+  all.reserve(n);
+  for (auto& e : *edges) {
+    all.insert(all.end(), e.begin(), e.end());
+    e = {};
+  }
+  std::stable_sort(all.begin(), all.end(), [](const auto& a, const auto& b) {
+    return a.first < b.first;
+  });
+  for (const auto& [src, dst] : all) {
+    result.addEdge(src, dst);
+  }
+  result.freeze();
+  return result;
+}
+
+// Number of threads used by the parallel regions below, 1 without OpenMP.
+inline int maxThreads() {
+#if defined(_OPENMP)
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+// Id of the current thread in a parallel region, 0 without OpenMP.
+inline int threadNum() {
+#if defined(_OPENMP)
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+}  // namespace detail
+
+// reduceDAG returns a reduced DAG from a given frozen DAG. An edge is kept if
+// its target is not reachable from another successor of its source.
 template <typename T>
 osm2rdf::util::DirectedGraph<T> reduceDAG(
     const osm2rdf::util::DirectedGraph<T>& sourceDAG, bool showProgress) {
-  osm2rdf::util::DirectedGraph<T> result;
-  osm2rdf::util::ProgressBar progressBar{sourceDAG.getNumVertices(),
-                                         showProgress};
-  size_t entryCount = 0;
-  progressBar.update(entryCount);
-  // Reduce each adjacency list
-  const auto& vertices = sourceDAG.getVertices();
-#pragma omp parallel for shared(vertices, sourceDAG, result, progressBar, \
-                                entryCount) default(none)
-  for (size_t i = 0; i < vertices.size(); i++) {
-    const auto& src = vertices[i];
-    std::vector<T> possibleEdges(sourceDAG.findSuccessors(src));
-    std::vector<T> edges;
-    for (const auto& dst : sourceDAG.findSuccessors(src)) {
-      const auto& dstEdges = sourceDAG.findSuccessors(dst);
-      std::set_difference(possibleEdges.begin(), possibleEdges.end(),
-                          dstEdges.begin(), dstEdges.end(),
-                          std::back_inserter(edges));
-      possibleEdges = edges;
-      edges.clear();
-    }
-#pragma omp critical(addEdge)
-    {
-      for (const auto& dst : possibleEdges) {
-        result.addEdge(src, dst);
+  typedef typename DirectedGraph<T>::index_t index_t;
+  assert(sourceDAG.isFrozen());
+  const size_t n = sourceDAG.getNumVertices();
+  osm2rdf::util::ProgressBar progressBar{n, showProgress};
+  progressBar.update(0);
+
+  std::vector<std::vector<std::pair<T, T>>> edges(detail::maxThreads());
+#pragma omp parallel shared(sourceDAG, edges, progressBar, n) \
+    default(none)
+  {
+    std::vector<uint64_t> visited((n + 63) / 64, 0);
+    std::vector<index_t> marked;
+    std::vector<index_t> stack;
+    auto& out = edges[detail::threadNum()];
+#pragma omp for schedule(dynamic, 1024)
+    for (size_t i = 0; i < n; i++) {
+      const auto src = static_cast<index_t>(i);
+      // mark everything reachable from a successor of src, not counting the
+      // direct successors themselves
+      for (auto it = sourceDAG.edgesBegin(src); it != sourceDAG.edgesEnd(src);
+           it++) {
+        stack.push_back(*it);
+      }
+      while (!stack.empty()) {
+        const auto cur = stack.back();
+        stack.pop_back();
+        for (auto it = sourceDAG.edgesBegin(cur);
+             it != sourceDAG.edgesEnd(cur); it++) {
+          if (visited[*it / 64] & (1ULL << (*it % 64))) continue;
+          visited[*it / 64] |= 1ULL << (*it % 64);
+          marked.push_back(*it);
+          stack.push_back(*it);
+        }
       }
+      detail::keepUnmarkedEdges(sourceDAG, src, &visited, &marked, &out);
+      if (detail::threadNum() == 0) progressBar.update(i);
     }
-#pragma omp critical(progressReduce)
-    progressBar.update(entryCount++);
   }
   progressBar.done();
-  return result;
+  return detail::fromEdges(&edges);
 }
 
-// reduceMaximalConnectedDAG returns a reduced DAG from a given sorted and
-// maximal connected DAG
+// reduceMaximalConnectedDAG returns a reduced DAG from a given frozen maximal
+// connected (transitively closed) DAG. Here a target only reachable via
+// another successor is always a successor of that successor, so only direct
+// edges have to be checked.
 template <typename T>
 osm2rdf::util::DirectedGraph<T> reduceMaximalConnectedDAG(
     const osm2rdf::util::DirectedGraph<T>& sourceDAG, bool showProgress) {
-  osm2rdf::util::DirectedGraph<T> result;
-  osm2rdf::util::ProgressBar progressBar{sourceDAG.getNumVertices(),
-                                         showProgress};
-  size_t entryCount = 0;
-  progressBar.update(entryCount);
-  // Reduce each adjacency list
-  const auto& vertices = sourceDAG.getVertices();
-#pragma omp parallel for shared(vertices, sourceDAG, result, progressBar, \
-                                entryCount) default(none)
-  for (size_t i = 0; i < vertices.size(); i++) {
-    const auto& src = vertices[i];
-    std::vector<T> possibleEdges(sourceDAG.getEdges(src));
-    std::vector<T> edges;
-    for (const auto& dst : sourceDAG.getEdges(src)) {
-      const auto& dstEdges = sourceDAG.getEdges(dst);
-      std::set_difference(possibleEdges.begin(), possibleEdges.end(),
-                          dstEdges.begin(), dstEdges.end(),
-                          std::back_inserter(edges));
-      possibleEdges = edges;
-      edges.clear();
-    }
-#pragma omp critical(addEdge)
-    {
-      for (const auto& dst : possibleEdges) {
-        result.addEdge(src, dst);
+  typedef typename DirectedGraph<T>::index_t index_t;
+  assert(sourceDAG.isFrozen());
+  const size_t n = sourceDAG.getNumVertices();
+  osm2rdf::util::ProgressBar progressBar{n, showProgress};
+  progressBar.update(0);
+
+  std::vector<std::vector<std::pair<T, T>>> edges(detail::maxThreads());
+#pragma omp parallel shared(sourceDAG, edges, progressBar, n) \
+    default(none)
+  {
+    std::vector<uint64_t> visited((n + 63) / 64, 0);
+    std::vector<index_t> marked;
+    auto& out = edges[detail::threadNum()];
+#pragma omp for schedule(dynamic, 1024)
+    for (size_t i = 0; i < n; i++) {
+      const auto src = static_cast<index_t>(i);
+      for (auto it = sourceDAG.edgesBegin(src); it != sourceDAG.edgesEnd(src);
+           it++) {
+        for (auto jt = sourceDAG.edgesBegin(*it);
+             jt != sourceDAG.edgesEnd(*it); jt++) {
+          if (visited[*jt / 64] & (1ULL << (*jt % 64))) continue;
+          visited[*jt / 64] |= 1ULL << (*jt % 64);
+          marked.push_back(*jt);
+        }
       }
+      detail::keepUnmarkedEdges(sourceDAG, src, &visited, &marked, &out);
+      if (detail::threadNum() == 0) progressBar.update(i);
     }
-#pragma omp critical(progressReduceMax)
-    progressBar.update(entryCount++);
   }
   progressBar.done();
-  return result;
+  return detail::fromEdges(&edges);
 }
 
 }  // namespace osm2rdf::util
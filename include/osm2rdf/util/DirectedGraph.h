@@ -21,19 +21,33 @@
 
 #include <stdint.h>
 
+#include <cassert>
 #include <filesystem>
-#include <map>
+#include <utility>
 #include <vector>
 
 namespace osm2rdf::util {
 
+// Directed graph stored as compressed sparse rows. Edges are collected by
+// addEdge and the graph is frozen into the compressed representation by an
+// explicit call to freeze() once all edges are added. All read access
+// requires a frozen graph and is safe to be used concurrently. Adding an edge
+// to a frozen graph thaws it again.
 template <typename T>
 class DirectedGraph {
  public:
   typedef T entry_t;
+  // Index of a vertex in the frozen graph, vertices are numbered in ascending
+  // order of their ids.
+  typedef uint32_t index_t;
   // addEdge adds an edge between src and dst vertices. Allows multiple edges
   // between the same vertices.
   void addEdge(T src, T dst);
+  // freeze builds the compressed representation, no-op if already frozen.
+  void freeze();
+  // isFrozen returns true if all added edges are part of the compressed
+  // representation.
+  [[nodiscard]] bool isFrozen() const { return _frozen; }
   // findSuccessors returns the ids of all successor vertices of the given
   // vertex.
   std::vector<T> findSuccessors(T src) const;
@@ -46,23 +60,54 @@ class DirectedGraph {
   // path. This variant handles osm ids and converts for later lookup.
   void dumpOsm(const std::filesystem::path& filename) const;
   // prepareFindSuccessorsFast calculates for each vertex the successors and
-  // stores them in a helper map.
+  // stores them for faster lookup. For acyclic graphs the successors are
+  // computed bottom up in topological order.
   void prepareFindSuccessorsFast();
   // getNumEdges returns the number of stored edges. If an edge is defined
   // multiple times it is counted multiple times too.
   [[nodiscard]] size_t getNumEdges() const;
   // getNumVertices returns the number of unique vertices in the graph.
   [[nodiscard]] size_t getNumVertices() const;
-  // getVertices returns all unique vertices in the graph.
+  // getVertices returns all unique vertices in the graph, sorted.
   [[nodiscard]] std::vector<T> getVertices() const;
-  // getEdges returns the stored edges for the given vertex.
+  // getEdges returns the stored edges for the given vertex in insertion
+  // order.
   [[nodiscard]] std::vector<T> getEdges(T src) const;
 
+  // Index based access to the frozen graph.
+  [[nodiscard]] T getVertex(index_t i) const {
+    assert(_frozen);
+    return _vertices[i];
+  }
+  [[nodiscard]] const index_t* edgesBegin(index_t i) const {
+    assert(_frozen);
+    return _targets.data() + _offsets[i];
+  }
+  [[nodiscard]] const index_t* edgesEnd(index_t i) const {
+    assert(_frozen);
+    return _targets.data() + _offsets[i + 1];
+  }
+
  protected:
-  void findSuccessorsHelper(T src, std::vector<T>* tmp) const;
-  std::map<T, std::vector<T>> _adjacency;
-  std::map<T, std::vector<T>> _successors;
+  // Index of the given vertex, false if it is not part of the graph.
+  bool findIndex(T id, index_t* i) const;
+  // Sorted indices of all vertices reachable from src, without src.
+  void findSuccessorsHelper(index_t src, std::vector<index_t>* res) const;
+  // Move the edges of the compressed representation back to _edges.
+  void thaw();
+
+  // Edges added since the last freeze, in insertion order.
+  std::vector<std::pair<T, T>> _edges;
+  // Compressed representation, the edges of vertex i are
+  // _targets[_offsets[i]] to _targets[_offsets[i + 1] - 1].
+  std::vector<T> _vertices;
+  std::vector<size_t> _offsets{0};
+  std::vector<index_t> _targets;
+  // Successors of each vertex in the same representation.
+  std::vector<size_t> _successorOffsets;
+  std::vector<index_t> _successors;
   size_t _numEdges = 0;
+  bool _frozen = true;
   bool _preparedFast = false;
 };
 
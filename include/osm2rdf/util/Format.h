@@ -0,0 +1,49 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef OSM2RDF_UTIL_FORMAT_H_
+#define OSM2RDF_UTIL_FORMAT_H_
+
+#include <cstddef>
+
+namespace osm2rdf::util {
+
+// Highest precision for which formatFixed uses integer arithmetic.
+const static size_t FIXED_MAX_PRECISION = 9;
+// Buffer size sufficient for every output of formatFixed and formatFloat.
+const static size_t FORMAT_BUFFER_SIZE = 64;
+
+// Write v with prec decimal digits and trailing zeros (and a trailing dot)
+// removed into buf, with the same result as ::util::formatFloat. Up to
+// FIXED_MAX_PRECISION digits, v is converted once to a fixed point integer
+// which is then printed digit by digit. Values too close to a tie between two
+// outputs are passed on to formatFloat. Returns the number of chars written,
+// buf is not null terminated.
+size_t formatFixed(double v, size_t prec, char* buf);
+
+// Write v with prec decimal digits into buf, with the same result as
+// ::util::formatFloat (trimZeros = true) or printf's "%.<prec>f"
+// (trimZeros = false). Uses std::to_chars where available. Values whose
+// output would not fit into FORMAT_BUFFER_SIZE are written in the shortest
+// round trip representation instead. Returns the number of chars written,
+// buf is not null terminated.
+size_t formatFloat(double v, size_t prec, char* buf, bool trimZeros = true);
+
+}  // namespace osm2rdf::util
+
+#endif  // OSM2RDF_UTIL_FORMAT_H_
@@ -21,7 +21,9 @@
 
 #include <bzlib.h>
 #include <zlib.h>
+#include <filesystem>
 #include <fstream>
+#include <string>
 #include <vector>
 
 #include "osm2rdf/config/Config.h"
@@ -49,12 +51,22 @@ class Output { public:
   // Write a newline into the specified part.
   void writeNewLine(size_t part);
 
+  // Mark the end of a record in the specified part, used for records which
+  // do not end with a newline. Output to stdout is only flushed at the end
+  // of a record.
+  void writeRecordEnd(size_t part);
+
   void flush();
   // Flush the given part.
   void flush(size_t part);
   // Filename for given part. Special handling for -1 (prefix) and -2 (suffix).
   std::string partFilename(int part);
 
+  // Concatenate the given files into target without decompressing and
+  // recompressing streams. Returns false if target could not be written.
+  static bool merge(const std::vector<std::string>& files,
+                    const std::filesystem::path& target);
+
  protected:
   // Closes and concatenates all parts without decompressing and recompressing
   // streams.
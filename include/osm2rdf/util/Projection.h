@@ -0,0 +1,37 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef OSM2RDF_UTIL_PROJECTION_H_
+#define OSM2RDF_UTIL_PROJECTION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "util/geo/Geo.h"
+
+namespace osm2rdf::util {
+
+// Project n interleaved lon/lat pairs to web mercator points, multiplied by
+// prec and truncated to int32. Gives the same results as
+// ::util::geo::latLngToWebMerc, but without a DPoint per coordinate.
+void projectWebMercBatch(const double* lngLat, ::util::geo::I32Point* out,
+                         size_t n, double prec);
+
+}  // namespace osm2rdf::util
+
+#endif  // OSM2RDF_UTIL_PROJECTION_H_
@@ -0,0 +1,53 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef OSM2RDF_UTIL_SCAN_H_
+#define OSM2RDF_UTIL_SCAN_H_
+
+#include <cstddef>
+#include <string_view>
+
+namespace osm2rdf::util {
+
+// Scanners used by the writer to find the next byte which needs special
+// handling, so that the runs in between can be copied in bulk. Each returns
+// the position of the first such byte in s, or s.size() if there is none.
+// They use AVX2 or SSE4.2 if enabled at compile time and fall back to a
+// scalar loop otherwise.
+
+// First byte which has to be escaped in a STRING_LITERAL_QUOTE: '"', '\',
+// '\n' or '\r'.
+size_t findLiteralEscape(std::string_view s);
+
+// First byte which is not allowed in an IRIREF: #x00-#x20, '<', '>', '"',
+// '{', '}', '|', '^', '`' or '\'.
+size_t findIRIREFEscape(std::string_view s);
+
+// First byte which is not one of the PN_LOCAL chars allowed everywhere,
+// [A-Za-z0-9_:].
+size_t findPNLocalSpecial(std::string_view s);
+
+// Scalar versions of the above, exposed for testing.
+size_t findLiteralEscapeScalar(std::string_view s);
+size_t findIRIREFEscapeScalar(std::string_view s);
+size_t findPNLocalSpecialScalar(std::string_view s);
+
+}  // namespace osm2rdf::util
+
+#endif  // OSM2RDF_UTIL_SCAN_H_
@@ -0,0 +1,51 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef OSM2RDF_UTIL_SIMPLIFY_H_
+#define OSM2RDF_UTIL_SIMPLIFY_H_
+
+#include <cstddef>
+
+#include "util/geo/Geo.h"
+
+namespace osm2rdf::util {
+
+// Douglas-Peucker simplification in a single pass: instead of recursing,
+// the segment with the largest deviation is refined next, taken from a max
+// heap. Refinement stops once no removed point deviates by more than
+// maxDeviation and at least minPoints points are kept. This gives the same
+// points as the recursive algorithm whenever it keeps minPoints points
+// anyway, and never needs to be repeated with a smaller deviation.
+::util::geo::DLine simplify(const ::util::geo::DLine& line, double maxDeviation,
+                            size_t minPoints);
+
+// Geometry overloads. Lines keep at least their end points, rings keep at
+// least a closed triangle, so the result is never empty for a non-empty
+// input.
+::util::geo::DLine simplify(const ::util::geo::DLine& line,
+                            double maxDeviation);
+::util::geo::DPolygon simplify(const ::util::geo::DPolygon& polygon,
+                               double maxDeviation);
+::util::geo::DMultiPolygon simplify(
+    const ::util::geo::DMultiPolygon& multiPolygon, double maxDeviation);
+::util::geo::DCollection simplify(const ::util::geo::DCollection& collection,
+                                  double maxDeviation);
+
+}  // namespace osm2rdf::util
+
+#endif  // OSM2RDF_UTIL_SIMPLIFY_H_
@@ -19,7 +19,9 @@
 #ifndef OSM2RDF_UTIL_TIME_H
 #define OSM2RDF_UTIL_TIME_H
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -44,6 +46,76 @@ inline std::string currentTimeFormatted() {
   return oss.str();
 }
 
+// Length of a timestamp formatted by ISOTimeFormatter.
+const static size_t ISO_TIME_LENGTH = 19;
+
+// Formats seconds since epoch as "YYYY-MM-DDThh:mm:ss" (UTC) with integer
+// arithmetic only. The date part of the last formatted day is kept, as
+// consecutive timestamps often fall on the same day. Not thread safe, use one
+// instance per thread.
+class ISOTimeFormatter {
+ public:
+  // Writes exactly ISO_TIME_LENGTH chars into buf, buf is not null
+  // terminated.
+  void format(int64_t seconds, char* buf) {
+    int64_t day = seconds / SECONDS_PER_DAY;
+    int64_t secondOfDay = seconds % SECONDS_PER_DAY;
+    if (secondOfDay < 0) {
+      day--;
+      secondOfDay += SECONDS_PER_DAY;
+    }
+    if (day != _day) {
+      formatDate(day);
+      _day = day;
+    }
+    std::copy(_date, _date + DATE_LENGTH, buf);
+    const auto hour = secondOfDay / 3600;
+    const auto minute = (secondOfDay / 60) % 60;
+    const auto second = secondOfDay % 60;
+    buf[11] = '0' + hour / 10;
+    buf[12] = '0' + hour % 10;
+    buf[13] = ':';
+    buf[14] = '0' + minute / 10;
+    buf[15] = '0' + minute % 10;
+    buf[16] = ':';
+    buf[17] = '0' + second / 10;
+    buf[18] = '0' + second % 10;
+  }
+
+ private:
+  // Converts days since epoch to "YYYY-MM-DDT", see
+  // https://howardhinnant.github.io/date_algorithms.html#civil_from_days
+  void formatDate(int64_t day) {
+    day += 719468;
+    const int64_t era = (day >= 0 ? day : day - 146096) / 146097;
+    const auto doe = static_cast<uint32_t>(day - era * 146097);
+    const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const uint32_t mp = (5 * doy + 2) / 153;
+    const uint32_t d = doy - (153 * mp + 2) / 5 + 1;
+    const uint32_t m = mp < 10 ? mp + 3 : mp - 9;
+    const int64_t y = static_cast<int64_t>(yoe) + era * 400 + (m <= 2);
+
+    // 4 digit year
+    _date[0] = '0' + (y / 1000) % 10;
+    _date[1] = '0' + (y / 100) % 10;
+    _date[2] = '0' + (y / 10) % 10;
+    _date[3] = '0' + y % 10;
+    _date[4] = '-';
+    _date[5] = '0' + m / 10;
+    _date[6] = '0' + m % 10;
+    _date[7] = '-';
+    _date[8] = '0' + d / 10;
+    _date[9] = '0' + d % 10;
+    _date[10] = 'T';
+  }
+
+  static const int64_t SECONDS_PER_DAY = 86400;
+  static const size_t DATE_LENGTH = 11;
+  int64_t _day = INT64_MIN;
+  char _date[DATE_LENGTH];
+};
+
 }  // namespace osm2rdf::util
 
 #endif  // OSM2RDF_UTIL_TIME_H
@@ -21,6 +21,7 @@
 
 #include <filesystem>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 #if defined(_OPENMP)
@@ -37,6 +38,13 @@ std::string osm2rdf::config::Config::getInfo(std::string_view prefix) const {
   std::string datasetStrings[2] = {"OSM", "OHM"};
   oss << prefix << osm2rdf::config::constants::HEADER;
   oss << "\n" << prefix << osm2rdf::config::constants::SECTION_IO;
+  if (!mergeSpatialStripes.empty()) {
+    oss << "\n"
+        << prefix << osm2rdf::config::constants::MERGE_SPATIAL_STRIPES_INFO;
+    for (const auto& part : mergeSpatialStripes) {
+      oss << "\n" << prefix << prefix << part;
+    }
+  }
   oss << "\n"
       << prefix << osm2rdf::config::constants::INPUT_INFO << "          "
       << input;
@@ -46,6 +54,11 @@ std::string osm2rdf::config::Config::getInfo(std::string_view prefix) const {
   oss << "\n"
       << prefix << osm2rdf::config::constants::OUTPUT_INFO << "         "
       << output;
+  if (!spatialRelationsOutput.empty()) {
+    oss << "\n"
+        << prefix << osm2rdf::config::constants::SPATIAL_RELATIONS_OUTPUT_INFO
+        << " " << spatialRelationsOutput;
+  }
   oss << "\n"
       << prefix << osm2rdf::config::constants::OUTPUT_FORMAT_INFO << "  "
       << outputFormat;
@@ -82,6 +95,10 @@ std::string osm2rdf::config::Config::getInfo(std::string_view prefix) const {
             << prefix
             << osm2rdf::config::constants::ADD_WAY_NODE_SPATIAL_METADATA_INFO;
       }
+      if (skolemizeMembers) {
+        oss << "\n"
+            << prefix << osm2rdf::config::constants::SKOLEMIZE_MEMBERS_INFO;
+      }
       if (addAreaWayLinestrings) {
         oss << "\n"
             << prefix
@@ -166,10 +183,28 @@ std::string osm2rdf::config::Config::getInfo(std::string_view prefix) const {
       oss << "\n"
           << prefix << osm2rdf::config::constants::NO_WAY_GEOM_RELATIONS_INFO;
     }
-    if (simplifyGeometries > 0) {
+    if (!auxGeoFiles.empty()) {
+      oss << "\n" << prefix << osm2rdf::config::constants::AUX_GEO_FILES_INFO;
+      for (const auto& file : auxGeoFiles) {
+        oss << "\n" << prefix << prefix << file;
+      }
+      if (auxGeoFilesCache) {
+        oss << "\n"
+            << prefix << osm2rdf::config::constants::AUX_GEO_FILES_CACHE_INFO;
+      }
+    }
+    if (simplifyGeometries) {
+      oss << "\n"
+          << prefix << osm2rdf::config::constants::SIMPLIFY_GEOMETRIES_INFO;
+    }
+    if (reduceContains) {
+      oss << "\n"
+          << prefix << osm2rdf::config::constants::REDUCE_CONTAINS_INFO;
+    }
+    if (numSpatialStripes > 0) {
       oss << "\n"
-          << prefix << osm2rdf::config::constants::SIMPLIFY_GEOMETRIES_INFO
-          << std::to_string(simplifyGeometries);
+          << prefix << osm2rdf::config::constants::SPATIAL_STRIPE_INFO
+          << spatialStripe << "/" << numSpatialStripes;
     }
   }
   oss << "\n" << prefix << osm2rdf::config::constants::SECTION_MISCELLANEOUS;
@@ -185,6 +220,11 @@ std::string osm2rdf::config::Config::getInfo(std::string_view prefix) const {
     oss << "\n"
         << prefix << osm2rdf::config::constants::WRITE_RDF_STATISTICS_INFO;
   }
+  if (outputGroupSubjects) {
+    oss << "\n"
+        << prefix
+        << osm2rdf::config::constants::OUTPUT_GROUP_SUBJECTS_OPTION_INFO;
+  }
   if (outputKeepFiles) {
     oss << "\n"
         << prefix << osm2rdf::config::constants::OUTPUT_KEEP_FILES_OPTION_INFO;
@@ -362,6 +402,10 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
       osm2rdf::config::constants::ADD_WAY_NODE_SPATIAL_METADATA_OPTION_SHORT,
       osm2rdf::config::constants::ADD_WAY_NODE_SPATIAL_METADATA_OPTION_LONG,
       osm2rdf::config::constants::ADD_WAY_NODE_SPATIAL_METADATA_OPTION_HELP);
+  auto skolemizeMembersOp = parser.add<popl::Switch>(
+      osm2rdf::config::constants::SKOLEMIZE_MEMBERS_OPTION_SHORT,
+      osm2rdf::config::constants::SKOLEMIZE_MEMBERS_OPTION_LONG,
+      osm2rdf::config::constants::SKOLEMIZE_MEMBERS_OPTION_HELP);
   auto skipWikiLinksOp = parser.add<popl::Switch>(
       osm2rdf::config::constants::SKIP_WIKI_LINKS_OPTION_SHORT,
       osm2rdf::config::constants::SKIP_WIKI_LINKS_OPTION_LONG,
@@ -373,6 +417,28 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
           osm2rdf::config::constants::AUX_GEO_FILES_OPTION_LONG,
           osm2rdf::config::constants::AUX_GEO_FILES_OPTION_HELP);
 
+  auto auxGeoFilesCacheOp =
+      parser.add<popl::Switch, popl::Attribute::advanced>(
+          osm2rdf::config::constants::AUX_GEO_FILES_CACHE_OPTION_SHORT,
+          osm2rdf::config::constants::AUX_GEO_FILES_CACHE_OPTION_LONG,
+          osm2rdf::config::constants::AUX_GEO_FILES_CACHE_OPTION_HELP);
+
+  auto reduceContainsOp = parser.add<popl::Switch, popl::Attribute::advanced>(
+      osm2rdf::config::constants::REDUCE_CONTAINS_OPTION_SHORT,
+      osm2rdf::config::constants::REDUCE_CONTAINS_OPTION_LONG,
+      osm2rdf::config::constants::REDUCE_CONTAINS_OPTION_HELP);
+
+  auto spatialStripeOp =
+      parser.add<popl::Value<std::string>, popl::Attribute::expert>(
+          osm2rdf::config::constants::SPATIAL_STRIPE_OPTION_SHORT,
+          osm2rdf::config::constants::SPATIAL_STRIPE_OPTION_LONG,
+          osm2rdf::config::constants::SPATIAL_STRIPE_OPTION_HELP);
+  auto mergeSpatialStripesOp =
+      parser.add<popl::Value<std::string>, popl::Attribute::expert>(
+          osm2rdf::config::constants::MERGE_SPATIAL_STRIPES_OPTION_SHORT,
+          osm2rdf::config::constants::MERGE_SPATIAL_STRIPES_OPTION_LONG,
+          osm2rdf::config::constants::MERGE_SPATIAL_STRIPES_OPTION_HELP);
+
   auto numThreadsOp = parser.add<popl::Value<int>, popl::Attribute::advanced>(
       osm2rdf::config::constants::NUM_THREADS_OPTION_SHORT,
       osm2rdf::config::constants::NUM_THREADS_OPTION_LONG,
@@ -385,11 +451,10 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
           osm2rdf::config::constants::SEMICOLON_TAG_KEYS_OPTION_HELP);
 
   auto simplifyGeometriesOp =
-      parser.add<popl::Value<double>, popl::Attribute::expert>(
+      parser.add<popl::Switch, popl::Attribute::expert>(
           osm2rdf::config::constants::SIMPLIFY_GEOMETRIES_OPTION_SHORT,
           osm2rdf::config::constants::SIMPLIFY_GEOMETRIES_OPTION_LONG,
-          osm2rdf::config::constants::SIMPLIFY_GEOMETRIES_OPTION_HELP,
-          simplifyGeometries);
+          osm2rdf::config::constants::SIMPLIFY_GEOMETRIES_OPTION_HELP);
 
   auto simplifyWKTOp =
       parser.add<popl::Value<uint16_t>, popl::Attribute::advanced>(
@@ -423,6 +488,11 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
           osm2rdf::config::constants::OUTPUT_FORMAT_OPTION_SHORT,
           osm2rdf::config::constants::OUTPUT_FORMAT_OPTION_LONG,
           osm2rdf::config::constants::OUTPUT_FORMAT_OPTION_HELP, outputFormat);
+  auto outputGroupSubjectsOp =
+      parser.add<popl::Switch, popl::Attribute::advanced>(
+          osm2rdf::config::constants::OUTPUT_GROUP_SUBJECTS_OPTION_SHORT,
+          osm2rdf::config::constants::OUTPUT_GROUP_SUBJECTS_OPTION_LONG,
+          osm2rdf::config::constants::OUTPUT_GROUP_SUBJECTS_OPTION_HELP);
   auto outputKeepFilesOp = parser.add<popl::Switch, popl::Attribute::expert>(
       osm2rdf::config::constants::OUTPUT_KEEP_FILES_OPTION_SHORT,
       osm2rdf::config::constants::OUTPUT_KEEP_FILES_OPTION_LONG,
@@ -432,6 +502,19 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
           osm2rdf::config::constants::OUTPUT_COMPRESS_OPTION_SHORT,
           osm2rdf::config::constants::OUTPUT_COMPRESS_OPTION_LONG,
           osm2rdf::config::constants::OUTPUT_COMPRESS_OPTION_HELP, "bz2");
+  auto spatialRelationsOutputOp =
+      parser.add<popl::Value<std::string>, popl::Attribute::advanced>(
+          osm2rdf::config::constants::SPATIAL_RELATIONS_OUTPUT_OPTION_SHORT,
+          osm2rdf::config::constants::SPATIAL_RELATIONS_OUTPUT_OPTION_LONG,
+          osm2rdf::config::constants::SPATIAL_RELATIONS_OUTPUT_OPTION_HELP, "");
+  auto spatialRelationsOutputCompressOp =
+      parser.add<popl::Value<std::string>, popl::Attribute::advanced>(
+          osm2rdf::config::constants::
+              SPATIAL_RELATIONS_OUTPUT_COMPRESS_OPTION_SHORT,
+          osm2rdf::config::constants::
+              SPATIAL_RELATIONS_OUTPUT_COMPRESS_OPTION_LONG,
+          osm2rdf::config::constants::
+              SPATIAL_RELATIONS_OUTPUT_COMPRESS_OPTION_HELP);
   auto cacheOp = parser.add<popl::Value<std::string>>(
       osm2rdf::config::constants::CACHE_OPTION_SHORT,
       osm2rdf::config::constants::CACHE_OPTION_LONG,
@@ -527,8 +610,9 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
     addOsmMetadata = !noOsmMetadataOp->is_set();
     addMemberTriples = !noMemberTriplesOp->is_set();
     addWayNodeSpatialMetadata = addWayNodeSpatialMetadataOp->is_set();
+    skolemizeMembers = skolemizeMembersOp->is_set();
     skipWikiLinks = skipWikiLinksOp->is_set();
-    simplifyGeometries = simplifyGeometriesOp->value();
+    simplifyGeometries = simplifyGeometriesOp->is_set();
     simplifyWKT = simplifyWKTOp->value();
     wktDeviation = wktDeviationOp->value();
     wktPrecision = wktPrecisionOp->value();
@@ -559,6 +643,58 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
         auxGeoFiles.push_back(auxGeoFilesOp->value(i));
       }
     }
+    auxGeoFilesCache = auxGeoFilesCacheOp->is_set();
+    reduceContains = reduceContainsOp->is_set();
+
+    if (spatialStripeOp->is_set()) {
+      const std::string& val = spatialStripeOp->value();
+      size_t pos = val.find('/');
+      try {
+        if (pos == std::string::npos) {
+          throw std::invalid_argument(val);
+        }
+        size_t read = 0;
+        spatialStripe = std::stoul(val.substr(0, pos), &read);
+        if (read != pos) {
+          throw std::invalid_argument(val);
+        }
+        numSpatialStripes = std::stoul(val.substr(pos + 1), &read);
+        if (read != val.size() - pos - 1) {
+          throw std::invalid_argument(val);
+        }
+      } catch (const std::logic_error&) {
+        numSpatialStripes = 0;
+      }
+      if (numSpatialStripes == 0 || spatialStripe >= numSpatialStripes) {
+        throw popl::invalid_option(
+            spatialStripeOp.get(), popl::invalid_option::Error::invalid_argument,
+            popl::OptionName::long_name, val, "");
+      }
+      if (!auxGeoFiles.empty()) {
+        std::cerr << "Auxiliary geo files can not be combined with --"
+                  << osm2rdf::config::constants::SPATIAL_STRIPE_OPTION_LONG
+                  << "\n"
+                  << parser.help() << "\n";
+        exit(osm2rdf::config::ExitCode::FAILURE);
+      }
+      if (reduceContains) {
+        // The reduction needs all contains relations at once.
+        std::cerr << "--"
+                  << osm2rdf::config::constants::REDUCE_CONTAINS_OPTION_LONG
+                  << " can not be combined with --"
+                  << osm2rdf::config::constants::SPATIAL_STRIPE_OPTION_LONG
+                  << "\n"
+                  << parser.help() << "\n";
+        exit(osm2rdf::config::ExitCode::FAILURE);
+      }
+      // Facts do not depend on the stripe, only write them once.
+      noFacts |= spatialStripe > 0;
+    }
+    if (mergeSpatialStripesOp->is_set()) {
+      for (size_t i = 0; i < mergeSpatialStripesOp->count(); ++i) {
+        mergeSpatialStripes.push_back(mergeSpatialStripesOp->value(i));
+      }
+    }
 
     if (numThreadsOp->is_set()) numThreads = numThreadsOp->value();
 
@@ -579,7 +715,27 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
           popl::OptionName::long_name, outputCompressOp->value(), "");
     }
 
+    outputGroupSubjects = outputGroupSubjectsOp->is_set();
     outputKeepFiles = outputKeepFilesOp->is_set();
+
+    spatialRelationsOutput = spatialRelationsOutputOp->value();
+    spatialRelationsOutputCompress = outputCompress;
+    if (spatialRelationsOutputCompressOp->is_set()) {
+      const auto& val = spatialRelationsOutputCompressOp->value();
+      if (val == "none") {
+        spatialRelationsOutputCompress = NONE;
+      } else if (val == "gz") {
+        spatialRelationsOutputCompress = GZ;
+      } else if (val == "bz2") {
+        spatialRelationsOutputCompress = BZ2;
+      } else {
+        throw popl::invalid_option(
+            spatialRelationsOutputCompressOp.get(),
+            popl::invalid_option::Error::invalid_argument,
+            popl::OptionName::long_name, val, "");
+      }
+    }
+    spatialRelationsMergeOutput = mergeOutput;
     if (output.empty()) {
       outputCompress = NONE;
       mergeOutput = util::OutputMergeMode::NONE;
@@ -601,6 +757,20 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
       output += osm2rdf::config::constants::GZ_EXTENSION;
     }
 
+    if (spatialRelationsOutputCompress == BZ2 &&
+        !spatialRelationsOutput.empty() &&
+        spatialRelationsOutput.extension() !=
+            osm2rdf::config::constants::BZIP2_EXTENSION) {
+      spatialRelationsOutput += osm2rdf::config::constants::BZIP2_EXTENSION;
+    }
+
+    if (spatialRelationsOutputCompress == GZ &&
+        !spatialRelationsOutput.empty() &&
+        spatialRelationsOutput.extension() !=
+            osm2rdf::config::constants::GZ_EXTENSION) {
+      spatialRelationsOutput += osm2rdf::config::constants::GZ_EXTENSION;
+    }
+
     // osmium location cache
     cache = std::filesystem::absolute(cacheOp->value()).string();
 
@@ -616,6 +786,23 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
       exit(osm2rdf::config::ExitCode::CACHE_NOT_DIRECTORY);
     }
 
+    // Merging partial outputs does not read any input
+    if (!mergeSpatialStripes.empty()) {
+      if (output.empty()) {
+        std::cerr << "No output specified for merging!\n"
+                  << parser.help() << "\n";
+        exit(osm2rdf::config::ExitCode::FAILURE);
+      }
+      for (const auto& part : mergeSpatialStripes) {
+        if (!std::filesystem::exists(part)) {
+          std::cerr << "Input does not exist: " << part << "\n"
+                    << parser.help() << "\n";
+          exit(osm2rdf::config::ExitCode::INPUT_NOT_EXISTS);
+        }
+      }
+      return;
+    }
+
     // Handle input
     if (parser.non_option_args().size() != 1) {
       std::cerr << "No input specified!\n" << parser.help() << "\n";
@@ -661,6 +848,18 @@ void osm2rdf::config::Config::fromArgs(int argc, char** argv) {
 }
 
 // ____________________________________________________________________________
+osm2rdf::config::Config osm2rdf::config::Config::getSpatialRelationsConfig()
+    const {
+  Config relConfig = *this;
+  relConfig.output = spatialRelationsOutput;
+  relConfig.outputCompress = spatialRelationsOutputCompress;
+  relConfig.mergeOutput = spatialRelationsMergeOutput;
+  relConfig.rdfStatisticsPath = spatialRelationsOutput;
+  relConfig.rdfStatisticsPath += osm2rdf::config::constants::STATS_EXTENSION;
+  relConfig.rdfStatisticsPath += osm2rdf::config::constants::JSON_EXTENSION;
+  return relConfig;
+}
+
 std::filesystem::path osm2rdf::config::Config::getTempPath(
     const std::string& path, const std::string& suffix) const {
   std::filesystem::path resultPath{cache};
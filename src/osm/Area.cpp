@@ -33,40 +33,10 @@ osm2rdf::osm::Area::Area() {
 }
 
 // ____________________________________________________________________________
-void osm2rdf::osm::Area::finalize() noexcept {
-  // poly in area preserving projection
-  ::util::geo::DMultiPolygon lambertPoly;
-  lambertPoly.resize(_geom.size());
-
-  double EARTH_RAD = 6371008.7714;  // mean radius
-
-  for (size_t i = 0; i < _geom.size(); i++) {
-    const auto& poly = _geom[i];
-    lambertPoly[i].getOuter().reserve(poly.getOuter().size());
-    for (const auto& p : poly.getOuter()) {
-      lambertPoly[i].getOuter().push_back(
-          ::util::geo::DPoint{EARTH_RAD * (p.getX() * util::geo::RAD),
-                              EARTH_RAD * (sin(p.getY() * util::geo::RAD))});
-    }
-
-    lambertPoly[i].getInners().reserve(poly.getInners().size());
-
-    for (const auto& inner : poly.getInners()) {
-      lambertPoly[i].getInners().push_back({});
-      lambertPoly[i].getInners().back().reserve(inner.size());
-      for (const auto& p : inner) {
-        lambertPoly[i].getInners().back().push_back(
-            ::util::geo::DPoint{EARTH_RAD * (p.getX() * util::geo::RAD),
-                                EARTH_RAD * (sin(p.getY() * util::geo::RAD))});
-      }
-    }
-  }
-
-  _geomArea = ::util::geo::area(lambertPoly);
-}
+osm2rdf::osm::Area::Area(const osmium::Area& area) : Area() { reset(area); }
 
 // ____________________________________________________________________________
-osm2rdf::osm::Area::Area(const osmium::Area& area) : Area() {
+void osm2rdf::osm::Area::reset(const osmium::Area& area) {
   _id = area.positive_id();
   _objId = static_cast<osm2rdf::osm::Area::id_t>(area.orig_id());
 
@@ -79,6 +49,7 @@ osm2rdf::osm::Area::Area(const osmium::Area& area) : Area() {
   _geom.resize(outerRings.size());
   int oCount = 0;
   for (const auto& oring : outerRings) {
+    _geom[oCount].getOuter().clear();
     _geom[oCount].getOuter().reserve(oring.size());
     for (const auto& nodeRef : oring) {
       if (nodeRef.lon() < lonMin) {
@@ -104,6 +75,7 @@ osm2rdf::osm::Area::Area(const osmium::Area& area) : Area() {
     _geom[oCount].getInners().resize(innerRings.size());
     int iCount = 0;
     for (const auto& iring : innerRings) {
+      _geom[oCount].getInners()[iCount].clear();
       _geom[oCount].getInners()[iCount].reserve(iring.size());
       for (const auto& nodeRef : iring) {
         _geom[oCount].getInners()[iCount].push_back(
@@ -115,6 +87,11 @@ osm2rdf::osm::Area::Area(const osmium::Area& area) : Area() {
   }
 
   _envelope = ::util::geo::DBox({lonMin, latMin}, {lonMax, latMax});
+
+  _geomArea.reset();
+  _centroid.reset();
+  _convexHull.reset();
+  _obb.reset();
 }
 
 // ____________________________________________________________________________
@@ -136,29 +113,69 @@ const ::util::geo::DBox& osm2rdf::osm::Area::envelope() const noexcept {
 }
 
 // ____________________________________________________________________________
-double osm2rdf::osm::Area::geomArea() const noexcept { return _geomArea; }
+double osm2rdf::osm::Area::geomArea() const noexcept {
+  if (_geomArea) return *_geomArea;
+
+  // Sum up the areas of the polygons in an area preserving projection. Only
+  // one projected polygon is held at a time.
+  const double EARTH_RAD = 6371008.7714;  // mean radius
+  ::util::geo::DPolygon lambertPoly;
+  double res = 0;
+
+  for (const auto& poly : _geom) {
+    lambertPoly.getOuter().clear();
+    lambertPoly.getOuter().reserve(poly.getOuter().size());
+    for (const auto& p : poly.getOuter()) {
+      lambertPoly.getOuter().push_back(
+          ::util::geo::DPoint{EARTH_RAD * (p.getX() * util::geo::RAD),
+                              EARTH_RAD * (sin(p.getY() * util::geo::RAD))});
+    }
+
+    lambertPoly.getInners().resize(poly.getInners().size());
+    for (size_t i = 0; i < poly.getInners().size(); i++) {
+      auto& lambertInner = lambertPoly.getInners()[i];
+      lambertInner.clear();
+      lambertInner.reserve(poly.getInners()[i].size());
+      for (const auto& p : poly.getInners()[i]) {
+        lambertInner.push_back(
+            ::util::geo::DPoint{EARTH_RAD * (p.getX() * util::geo::RAD),
+                                EARTH_RAD * (sin(p.getY() * util::geo::RAD))});
+      }
+    }
+
+    res += ::util::geo::area(lambertPoly);
+  }
+
+  _geomArea = res;
+  return res;
+}
 
 // ____________________________________________________________________________
-::util::geo::DPolygon osm2rdf::osm::Area::convexHull() const noexcept {
-  return ::util::geo::convexHull(_geom);
+const ::util::geo::DPolygon& osm2rdf::osm::Area::convexHull() const noexcept {
+  if (!_convexHull) _convexHull = ::util::geo::convexHull(_geom);
+  return *_convexHull;
 }
 
 // ____________________________________________________________________________
-::util::geo::DPolygon osm2rdf::osm::Area::orientedBoundingBox() const noexcept {
-  return ::util::geo::convexHull(::util::geo::getOrientedEnvelope(_geom));
+const ::util::geo::DPolygon& osm2rdf::osm::Area::orientedBoundingBox()
+    const noexcept {
+  if (!_obb) {
+    _obb = ::util::geo::convexHull(::util::geo::getOrientedEnvelope(_geom));
+  }
+  return *_obb;
 }
 
 // ____________________________________________________________________________
-const ::util::geo::DPoint osm2rdf::osm::Area::centroid() const noexcept {
-  return ::util::geo::centroid(_geom);
+const ::util::geo::DPoint& osm2rdf::osm::Area::centroid() const noexcept {
+  if (!_centroid) _centroid = ::util::geo::centroid(_geom);
+  return *_centroid;
 }
 
 // ____________________________________________________________________________
 bool osm2rdf::osm::Area::operator==(
     const osm2rdf::osm::Area& other) const noexcept {
   return _id == other._id && _objId == other._objId &&
-         _geomArea == other._geomArea && _envelope == other._envelope &&
-         _geom == other._geom;
+         _envelope == other._envelope && _geom == other._geom;
 }
 
 // ____________________________________________________________________________
@@ -21,8 +21,10 @@
 
 #include <time.h>
 
-#include <iomanip>
+#include <algorithm>
+#include <charconv>
 #include <iostream>
+#include <iterator>
 
 #include "osm2rdf/config/Config.h"
 #include "osm2rdf/osm/Area.h"
@@ -31,10 +33,18 @@
 #include "osm2rdf/osm/Relation.h"
 #include "osm2rdf/osm/Way.h"
 #include "osm2rdf/ttl/Writer.h"
+#include "osm2rdf/util/Date.h"
+#include "osm2rdf/util/Format.h"
+#include "osm2rdf/util/Simplify.h"
+
+#if defined(_OPENMP)
+#include "omp.h"
+#endif
 
 using osm2rdf::osm::constants::AREA_PRECISION;
 using osm2rdf::osm::constants::LENGTH_PRECISION;
 using osm2rdf::osm::constants::BASE_SIMPLIFICATION_FACTOR;
+using osm2rdf::osm::constants::TAG_PREDICATE_CACHE_SIZE;
 using osm2rdf::ttl::constants::CHANGESET_NAMESPACE;
 using osm2rdf::ttl::constants::DATASET_ID;
 using osm2rdf::ttl::constants::IRI__GEOSPARQL__AS_WKT;
@@ -78,9 +88,11 @@ using osm2rdf::ttl::constants::IRI__XSD__YEAR_MONTH;
 using osm2rdf::ttl::constants::IRI_PREFIX_NODE_TAGGED;
 using osm2rdf::ttl::constants::LITERAL__FALSE;
 using osm2rdf::ttl::constants::LITERAL__TRUE;
+using osm2rdf::ttl::constants::NAMESPACE__GEOSPARQL;
 using osm2rdf::ttl::constants::NAMESPACE__OSM2RDF;
 using osm2rdf::ttl::constants::NAMESPACE__OSM2RDF_GEOM;
 using osm2rdf::ttl::constants::NAMESPACE__OSM2RDF_META;
+using osm2rdf::ttl::constants::NAMESPACE__OSM2RDF_MEMBER;
 using osm2rdf::ttl::constants::NAMESPACE__OSM2RDF_TAG;
 using osm2rdf::ttl::constants::NAMESPACE__OSM_RELATION;
 using osm2rdf::ttl::constants::NAMESPACE__OSM_TAG;
@@ -96,7 +108,13 @@ using osm2rdf::ttl::constants::WAY_NAMESPACE;
 template <typename W>
 osm2rdf::osm::FactHandler<W>::FactHandler(const osm2rdf::config::Config& config,
                                           osm2rdf::ttl::Writer<W>* writer)
-    : _config(config), _writer(writer), _locationHandler(nullptr) {
+    : _config(config),
+      _writer(writer),
+      _locationHandler(nullptr),
+      _tagTypes({{"admin_level", TagType::INTEGER},
+                 {"start_date", TagType::DATE},
+                 {"end_date", TagType::DATE}}),
+      _tagInfos(config.numThreads) {
   _separateUntaggedNodePrefixes = _config.iriPrefixForUntaggedNodes !=
                                   IRI_PREFIX_NODE_TAGGED[_config.sourceDataset];
   _datasetId = DATASET_ID[_config.sourceDataset];
@@ -104,10 +122,34 @@ osm2rdf::osm::FactHandler<W>::FactHandler(const osm2rdf::config::Config& config,
   _wayNamespace = WAY_NAMESPACE[_config.sourceDataset];
   _changesetNamespace = CHANGESET_NAMESPACE[_config.sourceDataset];
   _iriXSDDouble = "^^" + IRI__XSD__DOUBLE;
-  _iriXSDInteger = "^^" + IRI__XSD__INTEGER;
+  _iriXSDDecimal = "^^" + IRI__XSD__DECIMAL;
+  _iriXSDYear = "^^" + IRI__XSD__YEAR;
+  _iriXSDYearMonth = "^^" + IRI__XSD__YEAR_MONTH;
+  _iriXSDDate = "^^" + IRI__XSD__DATE;
   _iriWKTLiteral = "^^" + IRI__GEOSPARQL__WKT_LITERAL;
   _tagTripleCountIRI = _writer->generateIRIUnsafe(NAMESPACE__OSM2RDF, "facts");
   _areaIRI = writer->generateIRIUnsafe(NAMESPACE__OSM2RDF, "area");
+  _hasCompleteGeometryIRI =
+      _writer->generateIRIUnsafe(NAMESPACE__OSM2RDF, "hasCompleteGeometry");
+  _relationMemberIRI =
+      _writer->generateIRIUnsafe(NAMESPACE__OSM_RELATION, "member");
+  _tagKeyIRI = _writer->generateIRI(NAMESPACE__OSM_TAG, "key");
+  _tagValueIRI = _writer->generateIRI(NAMESPACE__OSM_TAG, "value");
+  _relPrefix = _writer->prefixId(_relNamespace);
+  _wayPrefix = _writer->prefixId(_wayNamespace);
+  _changesetPrefix = _writer->prefixId(_changesetNamespace);
+  _nodePrefix = _writer->prefixId(NODE_NAMESPACE[_config.sourceDataset]);
+  _taggedNodePrefix =
+      _writer->prefixId(NODE_NAMESPACE_TAGGED[_config.sourceDataset]);
+  _untaggedNodePrefix =
+      _writer->prefixId(NODE_NAMESPACE_UNTAGGED[_config.sourceDataset]);
+  _tagPrefix = _writer->prefixId(NAMESPACE__OSM_TAG);
+  _wikidataPrefix = _writer->prefixId(NAMESPACE__WIKIDATA_ENTITY);
+  _geomPrefix = _writer->prefixId(NAMESPACE__OSM2RDF_GEOM);
+  _geosparqlPrefix = _writer->prefixId(NAMESPACE__GEOSPARQL);
+  if (_config.skolemizeMembers) {
+    _memberPrefix = _writer->prefixId(NAMESPACE__OSM2RDF_MEMBER);
+  }
 }
 
 // ____________________________________________________________________________
@@ -120,13 +162,12 @@ void osm2rdf::osm::FactHandler<W>::setLocationHandler(
 // ____________________________________________________________________________
 template <typename W>
 void osm2rdf::osm::FactHandler<W>::area(const osm2rdf::osm::Area& area) {
-  const std::string& sid = std::to_string(area.objId());
-  const std::string& subj =
-      _writer->generateIRI(area.fromWay() ? _wayNamespace : _relNamespace, sid);
+  const std::string& subj = _writer->generateIRI(
+      area.fromWay() ? _wayPrefix : _relPrefix, area.objId());
 
   const std::string& geomObj = _writer->generateIRIUnsafe(
-      NAMESPACE__OSM2RDF_GEOM,
-      _datasetId + (area.fromWay() ? "way_" : "rel_") + sid);
+      _geomPrefix, _datasetId + (area.fromWay() ? "way_" : "rel_"),
+      area.objId());
 
   _writer->writeTriple(subj, IRI__GEOSPARQL__HAS_GEOMETRY, geomObj);
 
@@ -138,8 +179,9 @@ void osm2rdf::osm::FactHandler<W>::area(const osm2rdf::osm::Area& area) {
 
   if (_config.addCentroid) {
     const std::string& centroidObj = _writer->generateIRIUnsafe(
-        NAMESPACE__OSM2RDF_GEOM,
-        _datasetId + (area.fromWay() ? "way_" : "rel_") + "centroid_" + sid);
+        _geomPrefix,
+        _datasetId + (area.fromWay() ? "way_" : "rel_") + "centroid_",
+        area.objId());
     _writer->writeTriple(subj, IRI__GEOSPARQL__HAS_CENTROID, centroidObj);
     writeGeometry(centroidObj, IRI__GEOSPARQL__AS_WKT, area.centroid());
   }
@@ -158,8 +200,11 @@ void osm2rdf::osm::FactHandler<W>::area(const osm2rdf::osm::Area& area) {
 
   // Increase default precision as areas in regbez freiburg have a 0 area
   // otherwise.
+  char buf[osm2rdf::util::FORMAT_BUFFER_SIZE];
   _writer->writeLiteralTripleUnsafe(
-      subj, _areaIRI, ::util::formatFloat(area.geomArea(), AREA_PRECISION),
+      subj, _areaIRI,
+      std::string_view(buf, osm2rdf::util::formatFloat(area.geomArea(),
+                                                       AREA_PRECISION, buf)),
       _iriXSDDouble);
 
   if (!area.fromWay()) {
@@ -167,7 +212,7 @@ void osm2rdf::osm::FactHandler<W>::area(const osm2rdf::osm::Area& area) {
     // consistency with non-area relations
     _writer->writeTriple(
         subj,
-        _writer->generateIRIUnsafe(NAMESPACE__OSM2RDF, "hasCompleteGeometry"),
+        _hasCompleteGeometryIRI,
             osm2rdf::ttl::constants::LITERAL__TRUE
             );
   }
@@ -177,15 +222,13 @@ void osm2rdf::osm::FactHandler<W>::area(const osm2rdf::osm::Area& area) {
 template <typename W>
 void osm2rdf::osm::FactHandler<W>::node(const osmium::Node& node) {
   const bool untagged = node.tags().empty();
-  const std::string& sid = std::to_string(node.id());
+  const uint64_t id = node.positive_id();
 
-  const std::string& subj =
-      !_separateUntaggedNodePrefixes
-          ? _writer->generateIRI(NODE_NAMESPACE[_config.sourceDataset], sid)
-          : (untagged ? _writer->generateIRI(
-                            NODE_NAMESPACE_UNTAGGED[_config.sourceDataset], sid)
-                      : _writer->generateIRI(
-                            NODE_NAMESPACE_TAGGED[_config.sourceDataset], sid));
+  const std::string& subj = _writer->generateIRI(
+      !_separateUntaggedNodePrefixes ? _nodePrefix
+      : untagged                     ? _untaggedNodePrefix
+                                     : _taggedNodePrefix,
+      id);
 
   _writer->writeTriple(subj, IRI__RDF__TYPE, IRI__OSM__NODE);
 
@@ -197,11 +240,11 @@ void osm2rdf::osm::FactHandler<W>::node(const osmium::Node& node) {
 
   if (node.location().valid()) {
     const std::string& geomObj = _writer->generateIRIUnsafe(
-        NAMESPACE__OSM2RDF_GEOM, _datasetId +
-                                     (!_separateUntaggedNodePrefixes ? "node_"
-                                      : untagged ? "node_untagged_"
-                                                 : "node_tagged_") +
-                                     sid);
+        _geomPrefix,
+        _datasetId + (!_separateUntaggedNodePrefixes ? "node_"
+                      : untagged                     ? "node_untagged_"
+                                                     : "node_tagged_"),
+        id);
 
     auto geom = ::util::geo::DPoint{node.location().lon_without_check(),
                                     node.location().lat_without_check()};
@@ -211,7 +254,7 @@ void osm2rdf::osm::FactHandler<W>::node(const osmium::Node& node) {
 
     if (_config.addCentroid) {
       const std::string& centroidObj = _writer->generateIRIUnsafe(
-          NAMESPACE__OSM2RDF_GEOM, _datasetId + "_node_centroid_" + sid);
+          _geomPrefix, _datasetId + "_node_centroid_", id);
       _writer->writeTriple(subj, IRI__GEOSPARQL__HAS_CENTROID, centroidObj);
       writeGeometry(centroidObj, IRI__GEOSPARQL__AS_WKT, geom);
     }
@@ -240,8 +283,7 @@ void osm2rdf::osm::FactHandler<W>::node(const osmium::Node& node) {
 template <typename W>
 void osm2rdf::osm::FactHandler<W>::relation(
     const osm2rdf::osm::Relation& relation) {
-  const std::string& sid = std::to_string(relation.id());
-  const std::string& subj = _writer->generateIRI(_relNamespace, sid);
+  const std::string& subj = _writer->generateIRI(_relPrefix, relation.id());
 
   _writer->writeTriple(subj, IRI__RDF__TYPE, IRI__OSM__RELATION);
   // Meta
@@ -252,80 +294,81 @@ void osm2rdf::osm::FactHandler<W>::relation(
 
   if (_config.addMemberTriples && relation.members().size()) {
     size_t inRelPos = 0;
+    // only skolemized member IRIs need the base
+    std::string memberBase;
+    if (_config.skolemizeMembers) {
+      memberBase =
+          _datasetId + "rel_" + std::to_string(relation.id()) + "_";
+    }
+    std::string memberNode;
     for (const auto& member : relation.members()) {
-      std::string type;
+      osm2rdf::ttl::PrefixId type;
       switch (member.type()) {
         case osmium::item_type::node:
           if (!_separateUntaggedNodePrefixes) {
-            type = NODE_NAMESPACE[_config.sourceDataset];
+            type = _nodePrefix;
           } else if (_locationHandler->get_node_is_tagged(
                          member.positive_ref())) {
-            type = NODE_NAMESPACE_TAGGED[_config.sourceDataset];
+            type = _taggedNodePrefix;
           } else {
-            type = NODE_NAMESPACE_UNTAGGED[_config.sourceDataset];
+            type = _untaggedNodePrefix;
           }
           break;
         case osmium::item_type::relation:
-          type = _relNamespace;
+          type = _relPrefix;
           break;
         case osmium::item_type::way:
-          type = _wayNamespace;
+          type = _wayPrefix;
           break;
         default:
           continue;
       }
 
-      std::string role = member.role();
+      std::string_view role = member.role();
       if (role.empty()) role = "member";
-      const std::string& blankNode = _writer->generateBlankNode();
-      _writer->writeTriple(
-          subj, _writer->generateIRIUnsafe(NAMESPACE__OSM_RELATION, "member"),
-          blankNode);
-
-      _writer->writeTriple(blankNode, IRI__OSMREL__MEMBER_ID,
-                           _writer->generateIRI(type, member.positive_ref()));
-      _writer->writeTriple(blankNode, IRI__OSMREL__MEMBER_ROLE,
-                           _writer->generateLiteral(role));
-      _writer->writeLiteralTripleUnsafe(blankNode, IRI__OSMREL__MEMBER_POS,
-                                        std::to_string(inRelPos++),
-                                        _iriXSDInteger);
+      generateMemberNode(memberBase, inRelPos, &memberNode);
+      _writer->writeTriple(subj, _relationMemberIRI, memberNode);
+
+      _writer->writeIRITriple(memberNode, IRI__OSMREL__MEMBER_ID, type,
+                              member.positive_ref());
+      _writer->writeLiteralTriple(memberNode, IRI__OSMREL__MEMBER_ROLE, role);
+      _writer->writeIntegerLiteralTriple(memberNode, IRI__OSMREL__MEMBER_POS,
+                                         inRelPos++);
     }
   }
 
   if (relation.hasGeometry()) {
     const std::string& geomObj = _writer->generateIRIUnsafe(
-        NAMESPACE__OSM2RDF_GEOM, _datasetId + "rel_" + sid);
+        _geomPrefix, _datasetId + "rel_", relation.id());
 
     _writer->writeTriple(subj, IRI__GEOSPARQL__HAS_GEOMETRY, geomObj);
     writeGeometry(geomObj, IRI__GEOSPARQL__AS_WKT, relation.geom());
 
     if (_config.addCentroid) {
       const std::string& centroidObj = _writer->generateIRIUnsafe(
-          NAMESPACE__OSM2RDF_GEOM, _datasetId + "rel_centroid_" + sid);
+          _geomPrefix, _datasetId + "rel_centroid_", relation.id());
       _writer->writeTriple(subj, IRI__GEOSPARQL__HAS_CENTROID, centroidObj);
-      writeGeometry(centroidObj, IRI__GEOSPARQL__AS_WKT,
-                    ::util::geo::centroid(relation.geom()));
+      writeGeometry(centroidObj, IRI__GEOSPARQL__AS_WKT, relation.centroid());
     }
 
     if (_config.addConvexHull) {
       writeGeometry(subj, IRI__OSM2RDF_GEOM__CONVEX_HULL,
-                    ::util::geo::convexHull(relation.geom()));
+                    relation.convexHull());
     }
 
     if (_config.addEnvelope) {
       writeBox(subj, osm2rdf::ttl::constants::IRI__OSM2RDF_GEOM__ENVELOPE,
-               ::util::geo::getBoundingBox(relation.geom()));
+               relation.envelope());
     }
 
     if (_config.addObb) {
       writeGeometry(subj, IRI__OSM2RDF_GEOM__OBB,
-                    ::util::geo::convexHull(
-                        ::util::geo::getOrientedEnvelope(relation.geom())));
+                    relation.orientedBoundingBox());
     }
 
     _writer->writeTriple(
         subj,
-        _writer->generateIRIUnsafe(NAMESPACE__OSM2RDF, "hasCompleteGeometry"),
+        _hasCompleteGeometryIRI,
         relation.hasCompleteGeometry()
             ? osm2rdf::ttl::constants::LITERAL__TRUE
             : osm2rdf::ttl::constants::LITERAL__FALSE);
@@ -335,8 +378,7 @@ void osm2rdf::osm::FactHandler<W>::relation(
 // ____________________________________________________________________________
 template <typename W>
 void osm2rdf::osm::FactHandler<W>::way(const osm2rdf::osm::Way& way) {
-  const std::string& sid = std::to_string(way.id());
-  const std::string& subj = _writer->generateIRIUnsafe(_wayNamespace, sid);
+  const std::string& subj = _writer->generateIRI(_wayPrefix, way.id());
 
   _writer->writeTriple(subj, IRI__RDF__TYPE, IRI__OSM__WAY);
 
@@ -348,35 +390,39 @@ void osm2rdf::osm::FactHandler<W>::way(const osm2rdf::osm::Way& way) {
 
   if (_config.addMemberTriples && way.nodes().size()) {
     size_t wayOrder = 0;
-    std::string lastBlankNode;
+    // only skolemized member IRIs need the base
+    std::string memberBase;
+    if (_config.skolemizeMembers) {
+      memberBase = _datasetId + "way_" + std::to_string(way.id()) + "_";
+    }
+    std::string memberNode;
+    std::string lastMemberNode;
     auto lastNode = way.nodes().front();
     for (const auto& node : way.nodes()) {
-      const std::string& blankNode = _writer->generateBlankNode();
-      _writer->writeTriple(subj, IRI__OSMWAY__NODE, blankNode);
+      generateMemberNode(memberBase, wayOrder, &memberNode);
+      _writer->writeTriple(subj, IRI__OSMWAY__NODE, memberNode);
 
-      std::string nodeNamespace;
-      if (_config.iriPrefixForUntaggedNodes ==
-          IRI_PREFIX_NODE_TAGGED[_config.sourceDataset]) {
-        nodeNamespace = NODE_NAMESPACE[_config.sourceDataset];
+      osm2rdf::ttl::PrefixId nodeNamespace;
+      if (!_separateUntaggedNodePrefixes) {
+        nodeNamespace = _nodePrefix;
       } else if (_locationHandler->get_node_is_tagged(node.positive_ref())) {
-        nodeNamespace = NODE_NAMESPACE_TAGGED[_config.sourceDataset];
+        nodeNamespace = _taggedNodePrefix;
       } else {
-        nodeNamespace = NODE_NAMESPACE_UNTAGGED[_config.sourceDataset];
+        nodeNamespace = _untaggedNodePrefix;
       }
 
-      _writer->writeTriple(
-          blankNode, osm2rdf::ttl::constants::IRI__OSMWAY__MEMBER_ID,
-          _writer->generateIRI(nodeNamespace, node.positive_ref()));
+      _writer->writeIRITriple(memberNode,
+                              osm2rdf::ttl::constants::IRI__OSMWAY__MEMBER_ID,
+                              nodeNamespace, node.positive_ref());
 
-      _writer->writeLiteralTripleUnsafe(
-          blankNode, osm2rdf::ttl::constants::IRI__OSMWAY__MEMBER_POS,
-          std::to_string(wayOrder++), _iriXSDInteger);
+      _writer->writeIntegerLiteralTriple(
+          memberNode, osm2rdf::ttl::constants::IRI__OSMWAY__MEMBER_POS,
+          wayOrder++);
 
-      if (_config.addWayNodeSpatialMetadata && !lastBlankNode.empty() &&
+      if (_config.addWayNodeSpatialMetadata && !lastMemberNode.empty() &&
           node.location().valid() && lastNode.location().valid()) {
-        _writer->writeTriple(
-            lastBlankNode, IRI__OSMWAY__NEXT_NODE,
-            _writer->generateIRI(nodeNamespace, node.positive_ref()));
+        _writer->writeIRITriple(lastMemberNode, IRI__OSMWAY__NEXT_NODE,
+                                nodeNamespace, node.positive_ref());
         // Haversine distance
         const double distanceLat = (node.location().lat_without_check() -
                                     lastNode.location().lat_without_check()) *
@@ -392,11 +438,16 @@ void osm2rdf::osm::FactHandler<W>::way(const osm2rdf::osm::Way& way) {
         const double distance = osm2rdf::osm::constants::EARTH_RADIUS_KM *
                                 osm2rdf::osm::constants::METERS_IN_KM * 2 *
                                 asin(sqrt(haversine));
+        // same output as std::to_string
+        char buf[osm2rdf::util::FORMAT_BUFFER_SIZE];
         _writer->writeLiteralTripleUnsafe(
-            lastBlankNode, IRI__OSMWAY__NEXT_NODE_DISTANCE,
-            std::to_string(distance), "^^" + IRI__XSD__DECIMAL);
+            lastMemberNode, IRI__OSMWAY__NEXT_NODE_DISTANCE,
+            std::string_view(
+                buf, osm2rdf::util::formatFloat(distance, 6, buf, false)),
+            _iriXSDDecimal);
       }
-      lastBlankNode = blankNode;
+      // Keep both buffers, the next member reuses the capacity
+      lastMemberNode.swap(memberNode);
       lastNode = node;
     }
   }
@@ -406,7 +457,7 @@ void osm2rdf::osm::FactHandler<W>::way(const osm2rdf::osm::Way& way) {
 
   if (_config.addAreaWayLinestrings || !way.isArea()) {
     const std::string& geomObj = _writer->generateIRIUnsafe(
-        NAMESPACE__OSM2RDF_GEOM, _datasetId + "way_" + sid);
+        _geomPrefix, _datasetId + "way_", way.id());
 
     _writer->writeTriple(subj, IRI__GEOSPARQL__HAS_GEOMETRY, geomObj);
     writeGeometry(geomObj, IRI__GEOSPARQL__AS_WKT, wayGeom);
@@ -417,43 +468,38 @@ void osm2rdf::osm::FactHandler<W>::way(const osm2rdf::osm::Way& way) {
     // are already written in the area handler
     if (_config.addCentroid) {
       const std::string& centroidObj = _writer->generateIRIUnsafe(
-          NAMESPACE__OSM2RDF_GEOM, _datasetId + "way_centroid_" + sid);
+          _geomPrefix, _datasetId + "way_centroid_", way.id());
       _writer->writeTriple(subj, IRI__GEOSPARQL__HAS_CENTROID, centroidObj);
-      writeGeometry(centroidObj, IRI__GEOSPARQL__AS_WKT,
-                    ::util::geo::centroid(wayGeom));
+      writeGeometry(centroidObj, IRI__GEOSPARQL__AS_WKT, way.centroid());
     }
 
     if (_config.addConvexHull) {
-      writeGeometry(subj, IRI__OSM2RDF_GEOM__CONVEX_HULL,
-                    ::util::geo::convexHull(wayGeom));
+      writeGeometry(subj, IRI__OSM2RDF_GEOM__CONVEX_HULL, way.convexHull());
     }
 
     if (_config.addEnvelope) {
-      writeBox(subj, IRI__OSM2RDF_GEOM__ENVELOPE,
-               ::util::geo::getBoundingBox(wayGeom));
+      writeBox(subj, IRI__OSM2RDF_GEOM__ENVELOPE, way.envelope());
     }
 
     if (_config.addObb) {
-      writeGeometry(
-          subj, IRI__OSM2RDF_GEOM__OBB,
-          ::util::geo::convexHull(::util::geo::getOrientedEnvelope(wayGeom)));
+      writeGeometry(subj, IRI__OSM2RDF_GEOM__OBB, way.orientedBoundingBox());
     }
   }
 
   if (_config.addWayMetadata) {
     _writer->writeTriple(subj, IRI__OSMWAY__IS_CLOSED,
                          way.closed() ? LITERAL__TRUE : LITERAL__FALSE);
-    _writer->writeLiteralTripleUnsafe(subj, IRI__OSMWAY__NODE_COUNT,
-                                      std::to_string(way.nodes().size()),
-                                      _iriXSDInteger);
-    _writer->writeLiteralTripleUnsafe(subj, IRI__OSMWAY__UNIQUE_NODE_COUNT,
-                                      std::to_string(numUniquePoints),
-                                      _iriXSDInteger);
+    _writer->writeIntegerLiteralTriple(subj, IRI__OSMWAY__NODE_COUNT,
+                                       way.nodes().size());
+    _writer->writeIntegerLiteralTriple(subj, IRI__OSMWAY__UNIQUE_NODE_COUNT,
+                                       numUniquePoints);
   }
 
+  char buf[osm2rdf::util::FORMAT_BUFFER_SIZE];
   _writer->writeLiteralTripleUnsafe(
       subj, IRI__OSM2RDF__LENGTH,
-      ::util::formatFloat(::util::geo::latLngLen(way.geom()), LENGTH_PRECISION),
+      std::string_view(buf, osm2rdf::util::formatFloat(
+                                way.length(), LENGTH_PRECISION, buf)),
       _iriXSDDouble);
 }
 
@@ -465,22 +511,14 @@ void osm2rdf::osm::FactHandler<W>::writeGeometry(const std::string& subj,
                                                  const G& geom) {
   if (_config.simplifyWKT > 0 &&
       ::util::geo::numPoints(geom) > _config.simplifyWKT) {
-    G simplifiedGeom;
-    auto perimeter_or_length = ::util::geo::len(geom);
-    do {
-      simplifiedGeom = ::util::geo::simplify(geom, BASE_SIMPLIFICATION_FACTOR *
-                                                       perimeter_or_length *
-                                                       _config.wktDeviation);
-      perimeter_or_length /= 2;
-    } while ((::util::geo::empty(simplifiedGeom)) &&
-             perimeter_or_length >= BASE_SIMPLIFICATION_FACTOR);
-    _writer->writeLiteralTripleUnsafe(
-        subj, pred, ::util::geo::getWKT(simplifiedGeom, _config.wktPrecision),
-        _iriWKTLiteral);
+    // single pass, the result always keeps valid rings and lines
+    writeGeometryLiteral(
+        subj, pred,
+        osm2rdf::util::simplify(geom, BASE_SIMPLIFICATION_FACTOR *
+                                          ::util::geo::len(geom) *
+                                          _config.wktDeviation));
   } else {
-    _writer->writeLiteralTripleUnsafe(
-        subj, pred, ::util::geo::getWKT(geom, _config.wktPrecision),
-        _iriWKTLiteral);
+    writeGeometryLiteral(subj, pred, geom);
   }
 }
 
@@ -489,23 +527,130 @@ template <typename W>
 void osm2rdf::osm::FactHandler<W>::writeGeometry(const std::string& subj,
                                                  const std::string& pred,
                                                  const ::util::geo::DPoint& p) {
+  writeGeometryLiteral(subj, pred, p);
+}
+
+// ____________________________________________________________________________
+template <typename W>
+template <typename G>
+void osm2rdf::osm::FactHandler<W>::writeGeometryLiteral(const std::string& subj,
+                                                        const std::string& pred,
+                                                        const G& geom) {
+  if (_config.wktPrecision > osm2rdf::util::FIXED_MAX_PRECISION) {
+    _writer->writeLiteralTripleUnsafe(
+        subj, pred, ::util::geo::getWKT(geom, _config.wktPrecision),
+        _iriWKTLiteral);
+    return;
+  }
+
   // directly construct WKT on the output buffer
+  _writer->writeTripleStart(subj, pred);
+  _writer->writeLiteralStart();
+  writeWKT(geom);
+  _writer->writeLiteralEnd(_geosparqlPrefix, "wktLiteral");
+  _writer->writeTripleEnd();
+}
 
-  _writer->write(subj);
-  _writer->write(' ');
-  _writer->write(pred);
-  _writer->write(' ');
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeWKTCoordinate(double v) {
+  char buf[osm2rdf::util::FORMAT_BUFFER_SIZE];
+  _writer->write(std::string_view(
+      buf, osm2rdf::util::formatFixed(v, _config.wktPrecision, buf)));
+}
+
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeWKTRing(const ::util::geo::DLine& ring,
+                                                bool close) {
+  _writer->write('(');
+  for (size_t i = 0; i < ring.size(); i++) {
+    if (i > 0) _writer->write(',');
+    writeWKTCoordinate(ring[i].getX());
+    _writer->write(' ');
+    writeWKTCoordinate(ring[i].getY());
+  }
+  // polygon rings are always written closed
+  if (close && ring.size() > 1 &&
+      (ring.front().getX() != ring.back().getX() ||
+       ring.front().getY() != ring.back().getY())) {
+    _writer->write(',');
+    writeWKTCoordinate(ring.front().getX());
+    _writer->write(' ');
+    writeWKTCoordinate(ring.front().getY());
+  }
+  _writer->write(')');
+}
 
-  _writer->write("\"POINT(");
-  _writer->write(::util::formatFloat(p.getX(), _config.wktPrecision));
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeWKTRings(
+    const ::util::geo::DPolygon& polygon) {
+  _writer->write('(');
+  writeWKTRing(polygon.getOuter(), true);
+  for (const auto& inner : polygon.getInners()) {
+    _writer->write(',');
+    writeWKTRing(inner, true);
+  }
+  _writer->write(')');
+}
+
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeWKT(const ::util::geo::DPoint& point) {
+  _writer->write("POINT(");
+  writeWKTCoordinate(point.getX());
   _writer->write(' ');
-  _writer->write(::util::formatFloat(p.getY(), _config.wktPrecision));
+  writeWKTCoordinate(point.getY());
+  _writer->write(')');
+}
+
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeWKT(const ::util::geo::DLine& line) {
+  _writer->write("LINESTRING");
+  writeWKTRing(line, false);
+}
+
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeWKT(
+    const ::util::geo::DPolygon& polygon) {
+  _writer->write("POLYGON");
+  writeWKTRings(polygon);
+}
+
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeWKT(
+    const ::util::geo::DMultiPolygon& multiPolygon) {
+  _writer->write("MULTIPOLYGON(");
+  for (size_t i = 0; i < multiPolygon.size(); i++) {
+    if (i > 0) _writer->write(',');
+    writeWKTRings(multiPolygon[i]);
+  }
   _writer->write(')');
-  _writer->write('"');
-  _writer->write(_iriWKTLiteral);
+}
 
-  _writer->write(" .");
-  _writer->writeNewLine();
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeWKT(
+    const ::util::geo::DCollection& collection) {
+  _writer->write("GEOMETRYCOLLECTION(");
+  for (size_t i = 0; i < collection.size(); i++) {
+    if (i > 0) _writer->write(',');
+    const auto& geom = collection[i];
+    // relations only consist of points and lines, everything else goes
+    // through the generic WKT serialization
+    if (geom.getType() == 0) {
+      writeWKT(geom.getPoint());
+    } else if (geom.getType() == 1) {
+      writeWKT(geom.getLine());
+    } else {
+      _writer->write(::util::geo::getWKT(geom, _config.wktPrecision));
+    }
+  }
+  _writer->write(')');
 }
 
 // ____________________________________________________________________________
@@ -527,9 +672,8 @@ void osm2rdf::osm::FactHandler<W>::writeMeta(const std::string& subj,
 
   // avoid writing empty changeset IDs, drop entire triple
   if (object.changeset() != 0) {
-    _writer->writeTriple(
-        subj, IRI__OSMMETA__CHANGESET,
-        _writer->generateIRI(_changesetNamespace, object.changeset()));
+    _writer->writeIRITriple(subj, IRI__OSMMETA__CHANGESET, _changesetPrefix,
+                            object.changeset());
   }
 
   _writer->writeSecondsAsISO(subj, IRI__OSMMETA__TIMESTAMP,
@@ -537,20 +681,16 @@ void osm2rdf::osm::FactHandler<W>::writeMeta(const std::string& subj,
 
   // avoid writing empty users, drop entire triple
   if (!object.user_is_anonymous() && strlen(object.user()) > 0) {
-    _writer->writeTriple(subj, IRI__OSMMETA__USER,
-                         _writer->generateLiteral(object.user(), ""));
+    _writer->writeLiteralTriple(subj, IRI__OSMMETA__USER, object.user());
   }
 
   // avoid writing empty user IDs, drop entire triple
   if (object.uid() != 0) {
-    _writer->writeTriple(subj, IRI__OSMMETA__UID,
-                         _writer->generateLiteralUnsafe(
-                             std::to_string(object.uid()), _iriXSDInteger));
+    _writer->writeIntegerLiteralTriple(subj, IRI__OSMMETA__UID, object.uid());
   }
 
-  _writer->writeTriple(subj, IRI__OSMMETA__VERSION,
-                       _writer->generateLiteralUnsafe(
-                           std::to_string(object.version()), _iriXSDInteger));
+  _writer->writeIntegerLiteralTriple(subj, IRI__OSMMETA__VERSION,
+                                     object.version());
 
   // only write visibility of it is false
   if (!object.visible()) {
@@ -570,29 +710,24 @@ void osm2rdf::osm::FactHandler<W>::writeMeta(const std::string& subj,
 
   // avoid writing empty changeset IDs, drop entire triple
   if (object.changeset() != 0) {
-    _writer->writeTriple(
-        subj, IRI__OSMMETA__CHANGESET,
-        _writer->generateIRI(_changesetNamespace, object.changeset()));
+    _writer->writeIRITriple(subj, IRI__OSMMETA__CHANGESET, _changesetPrefix,
+                            object.changeset());
   }
 
   _writer->writeSecondsAsISO(subj, IRI__OSMMETA__TIMESTAMP, object.timestamp());
 
   // avoid writing empty users, drop entire triple
   if (!object.user().empty()) {
-    _writer->writeTriple(subj, IRI__OSMMETA__USER,
-                         _writer->generateLiteral(object.user(), ""));
+    _writer->writeLiteralTriple(subj, IRI__OSMMETA__USER, object.user());
   }
 
   // avoid writing empty user IDs, drop entire triple
   if (object.uid() != 0) {
-    _writer->writeTriple(subj, IRI__OSMMETA__UID,
-                         _writer->generateLiteralUnsafe(
-                             std::to_string(object.uid()), _iriXSDInteger));
+    _writer->writeIntegerLiteralTriple(subj, IRI__OSMMETA__UID, object.uid());
   }
 
-  _writer->writeTriple(subj, IRI__OSMMETA__VERSION,
-                       _writer->generateLiteralUnsafe(
-                           std::to_string(object.version()), _iriXSDInteger));
+  _writer->writeIntegerLiteralTriple(subj, IRI__OSMMETA__VERSION,
+                                     object.version());
 
   // only write visibility of it is false
   if (!object.visible()) {
@@ -603,48 +738,141 @@ void osm2rdf::osm::FactHandler<W>::writeMeta(const std::string& subj,
   }
 }
 
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::generateMemberNode(
+    std::string_view base, uint64_t pos, std::string* memberNode) {
+  if (_config.skolemizeMembers) {
+    _writer->generateIRIUnsafe(_memberPrefix, base, pos, memberNode);
+    return;
+  }
+  memberNode->assign(_writer->newBlankNode());
+}
+
 // ____________________________________________________________________________
 template <typename W>
 void osm2rdf::osm::FactHandler<W>::writeTag(const std::string& subj,
                                             const char* key,
                                             const char* value) {
-  if (strcmp(key, "admin_level") == 0) {
-    const char* trimmed = value;
-    while (*trimmed && std::isspace(*trimmed)) trimmed++;
-    char* firstNonMatched;
-    int64_t lvl = strtoll(trimmed, &firstNonMatched,
-                          osm2rdf::osm::constants::BASE10_BASE);
-    while (*firstNonMatched && std::isspace(*firstNonMatched))
-      firstNonMatched++;
+  writeTag(subj, key, value, tagInfo(key));
+}
+
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeTag(const std::string& subj,
+                                            const char* key,
+                                            std::string_view value,
+                                            const TagInfo& tag) {
+  if (tag.type == TagType::INTEGER && !tag.predicate.empty()) {
+    std::string_view trimmed = value;
+    while (!trimmed.empty() && std::isspace(trimmed.front())) {
+      trimmed.remove_prefix(1);
+    }
+    while (!trimmed.empty() && std::isspace(trimmed.back())) {
+      trimmed.remove_suffix(1);
+    }
+    const char* begin = trimmed.data();
+    const char* end = trimmed.data() + trimmed.size();
+    // from_chars does not accept an explicit positive sign
+    if (trimmed.size() > 1 && trimmed[0] == '+' && trimmed[1] != '-') {
+      begin++;
+    }
+    int64_t lvl;
+    const auto res = std::from_chars(begin, end, lvl);
 
     // if integer, dump as xsd:integer
-    if (firstNonMatched != trimmed && (*firstNonMatched) == 0) {
-      _writer->writeTriple(
-          subj, _writer->generateIRIUnsafe(NAMESPACE__OSM_TAG, key),
-          _writer->generateLiteralUnsafe(std::to_string(lvl), _iriXSDInteger));
-    } else {
-      _writer->writeUnsafeIRILiteralTriple(
-          subj.c_str(), NAMESPACE__OSM_TAG.c_str(), key, value);
+    if (!trimmed.empty() && res.ec == std::errc() && res.ptr == end) {
+      _writer->writeIntegerLiteralTriple(subj, tag.predicate, lvl);
+      return;
     }
+  }
+
+  if (!tag.predicate.empty()) {
+    _writer->writeLiteralTriple(subj, tag.predicate, value);
   } else {
-    auto check = _writer->checkPN_LOCAL(key);
-    if (check == 0) {
-      _writer->writeUnsafeIRILiteralTriple(
-          subj.c_str(), NAMESPACE__OSM_TAG.c_str(), key, value);
-    } else if (check == 1) {
-      _writer->writeIRILiteralTriple(subj, NAMESPACE__OSM_TAG, key, value);
-    } else {
-      const std::string& blankNode = _writer->generateBlankNode();
-      _writer->writeTriple(subj, IRI__OSM__TAG, blankNode);
-
-      _writer->writeTriple(blankNode,
-                           _writer->generateIRI(NAMESPACE__OSM_TAG, "key"),
-                           _writer->generateLiteral(key));
-      _writer->writeTriple(blankNode,
-                           _writer->generateIRI(NAMESPACE__OSM_TAG, "value"),
-                           _writer->generateLiteral(value));
+    const osm2rdf::ttl::BlankNode blankNode = _writer->newBlankNode();
+    _writer->writeTriple(subj, IRI__OSM__TAG, blankNode);
+
+    _writer->writeLiteralTriple(blankNode, _tagKeyIRI, key);
+    _writer->writeLiteralTriple(blankNode, _tagValueIRI, value);
+  }
+}
+
+// ____________________________________________________________________________
+template <typename W>
+void osm2rdf::osm::FactHandler<W>::writeDateTag(const std::string& subj,
+                                                const TagInfo& tag,
+                                                std::string_view value) {
+  char buf[osm2rdf::util::DATE_BUFFER_SIZE];
+  size_t len = 0;
+  switch (osm2rdf::util::normalizeDate(value, buf, &len)) {
+    case osm2rdf::util::DateType::YEAR:
+      _writer->writeLiteralTripleUnsafe(subj, tag.typedPredicate,
+                                        std::string_view(buf, len),
+                                        _iriXSDYear);
+      break;
+    case osm2rdf::util::DateType::YEAR_MONTH:
+      _writer->writeLiteralTripleUnsafe(subj, tag.typedPredicate,
+                                        std::string_view(buf, len),
+                                        _iriXSDYearMonth);
+      break;
+    case osm2rdf::util::DateType::DATE:
+      _writer->writeLiteralTripleUnsafe(subj, tag.typedPredicate,
+                                        std::string_view(buf, len),
+                                        _iriXSDDate);
+      break;
+    case osm2rdf::util::DateType::INVALID:
+      break;
+  }
+}
+
+// ____________________________________________________________________________
+template <typename W>
+const typename osm2rdf::osm::FactHandler<W>::TagInfo&
+osm2rdf::osm::FactHandler<W>::tagInfo(const char* key) {
+  size_t thread = 0;
+#if defined(_OPENMP)
+  thread = omp_get_thread_num();
+#endif
+  auto& cache = _tagInfos[thread];
+
+  const std::string_view k{key};
+  const auto it = cache.infos.find(k);
+  if (it != cache.infos.end()) {
+    return it->second;
+  }
+
+  TagInfo info;
+  const auto type = _tagTypes.find(k);
+  if (type != _tagTypes.end()) {
+    info.type = type->second;
+  } else if (!_config.skipWikiLinks) {
+    if (k == "wikidata" || hasSuffix(key, ":wikidata", 9)) {
+      info.type = TagType::WIKIDATA;
+    } else if (k == "wikipedia" || hasSuffix(key, ":wikipedia", 10)) {
+      info.type = TagType::WIKIPEDIA;
     }
   }
+  info.splitValues = _config.semicolonTagKeys.find(std::string{k}) !=
+                     _config.semicolonTagKeys.end();
+
+  const auto check = _writer->checkPN_LOCAL(k);
+  if (check == 0) {
+    info.predicate = _writer->generateIRIUnsafe(NAMESPACE__OSM_TAG, k);
+  } else if (check == 1) {
+    info.predicate = _writer->generateIRI(NAMESPACE__OSM_TAG, k);
+  }
+  if (info.type == TagType::DATE || info.type == TagType::WIKIDATA ||
+      info.type == TagType::WIKIPEDIA) {
+    info.typedPredicate = _writer->generateIRI(NAMESPACE__OSM2RDF_TAG, k);
+  }
+
+  if (cache.infos.size() >= TAG_PREDICATE_CACHE_SIZE) {
+    cache.uncached = std::move(info);
+    return cache.uncached;
+  }
+  cache.keys.emplace_back(k);
+  return cache.infos.emplace(cache.keys.back(), std::move(info)).first->second;
 }
 
 // ____________________________________________________________________________
@@ -659,139 +887,68 @@ void osm2rdf::osm::FactHandler<W>::writeTagList(const std::string& subj,
       if (std::iswspace(*c)) *c = '_';
     }
 
-    const char* value = tag.value();
+    const std::string_view value{tag.value()};
+    const TagInfo& info = tagInfo(key);
 
-    // Special handling for ref tag splitting. Maybe generalize this...
-    if (_config.semicolonTagKeys.find(key) != _config.semicolonTagKeys.end() &&
-        strchr(value, ';') != 0) {
-      // very expensive, do this with less copying
+    if (info.splitValues) {
+      // Write each ';' separated part of the value as a separate tag
+      std::string_view rest = value;
       size_t end;
-      size_t start = 0;
-      std::string valueStr = value;
-      while ((end = valueStr.find(';', start)) != std::string::npos) {
-        const std::string& partialValue = valueStr.substr(start, (end - start));
-        writeTag(subj, key, partialValue.c_str());
+      while ((end = rest.find(';')) != std::string_view::npos) {
+        writeTag(subj, key, rest.substr(0, end), info);
         tagTripleCount++;
-        start = end + 1;
-      };
-      const std::string& partialValue = valueStr.substr(start, valueStr.size());
-      writeTag(subj, key, partialValue.c_str());
+        rest.remove_prefix(end + 1);
+      }
+      writeTag(subj, key, rest, info);
       tagTripleCount++;
     } else {
-      writeTag(subj, key, value);
+      writeTag(subj, key, value, info);
       tagTripleCount++;
     }
 
-    // Handling for wiki tags
-    if (!_config.skipWikiLinks &&
-        (strcmp(key, "wikidata") == 0 || hasSuffix(key, ":wikidata", 9))) {
+    if (info.type == TagType::WIKIDATA) {
       // Only take first wikidata entry if ; is found
-      std::string valueTmp = value;
-      const auto end = valueTmp.find(';');
-      if (end != std::string::npos) {
-        valueTmp = valueTmp.erase(end);
+      const std::string_view entity = value.substr(0, value.find(';'));
+      // Remove all but Q and digits to ensure Qdddddd format, without
+      // copying if the entity is well formed already
+      const auto isEntityChar = [](char c) {
+        return c == 'Q' || isdigit(c) != 0;
+      };
+      if (std::all_of(entity.begin(), entity.end(), isEntityChar)) {
+        _writer->writeIRITripleUnsafe(subj, info.typedPredicate,
+                                      _wikidataPrefix, entity);
+      } else {
+        std::string filtered;
+        filtered.reserve(entity.size());
+        std::copy_if(entity.begin(), entity.end(),
+                     std::back_inserter(filtered), isEntityChar);
+        _writer->writeIRITripleUnsafe(subj, info.typedPredicate,
+                                      _wikidataPrefix, filtered);
       }
-      // Remove all but Q and digits to ensure Qdddddd format
-      valueTmp.erase(
-          remove_if(valueTmp.begin(), valueTmp.end(),
-                    [](char chr) { return (chr != 'Q' && isdigit(chr) == 0); }),
-          valueTmp.end());
-
-      _writer->writeTriple(
-          subj, _writer->generateIRI(NAMESPACE__OSM2RDF_TAG, key),
-          _writer->generateIRI(NAMESPACE__WIKIDATA_ENTITY, valueTmp));
       tagTripleCount++;
     }
 
-    if (!_config.skipWikiLinks &&
-        (strcmp(key, "wikipedia") == 0 || hasSuffix(key, ":wikipedia", 10))) {
-      std::string valueTmp = value;
-      const auto pos = valueTmp.find(':');
-      if (pos != std::string::npos) {
-        const std::string& lang = valueTmp.substr(0, pos);
-        const std::string& entry = valueTmp.substr(pos + 1);
-        _writer->writeTriple(
-            subj, _writer->generateIRI(NAMESPACE__OSM2RDF_TAG, key),
-            _writer->generateIRI("https://" + lang + ".wikipedia.org/wiki/",
-                                 entry));
-        tagTripleCount++;
+    if (info.type == TagType::WIKIPEDIA) {
+      const auto pos = value.find(':');
+      if (pos != std::string_view::npos) {
+        _writer->writeIRIREFTriple(
+            subj, info.typedPredicate,
+            {"https://", value.substr(0, pos), ".wikipedia.org/wiki/",
+             value.substr(pos + 1)});
       } else {
-        _writer->writeTriple(
-            subj, _writer->generateIRI(NAMESPACE__OSM2RDF_TAG, key),
-            _writer->generateIRI("https://www.wikipedia.org/wiki/", value));
-        tagTripleCount++;
+        _writer->writeIRIREFTriple(subj, info.typedPredicate,
+                                   {"https://www.wikipedia.org/wiki/", value});
       }
+      tagTripleCount++;
     }
 
-    if (strcmp(key, "start_date") == 0 || strcmp(key, "end_date") == 0) {
-      std::string valueTmp = value;
-      // Abort if non digit and not -
-      if (std::any_of(valueTmp.cbegin(), valueTmp.cend(),
-                      [](char c) { return isdigit(c) == 0 && c != '-'; })) {
-        continue;
-      }
-
-      // Skip if empty
-      if (valueTmp.empty()) {
-        continue;
-      }
-      // Skip if only '-'
-      size_t minusCount = std::count(valueTmp.begin(), valueTmp.end(), '-');
-      if (minusCount == valueTmp.size()) {
-        continue;
-      }
-
-      std::string newValue;
-      newValue.reserve(valueTmp.size());
-      std::ostringstream tmp;
-      tmp << std::setfill('0');
-
-      size_t last = 0;
-      size_t next;
-      auto resultType = 0;
-      for (size_t i = 0; i < (minusCount + 1); ++i) {
-        next = valueTmp.find('-', last);
-        if (i == 0 && next == 0) {
-          newValue += '-';
-          last = next + 1;
-          continue;
-        }
-        auto val = std::atoi(valueTmp.substr(last, next - last).c_str());
-
-        // basic validity checks according to ISO 8601
-        if (resultType == 1 && (val < 1 || val > 12)) {
-          resultType = 9;  // error
-          break;
-        }
-
-        if (resultType == 2 && (val < 1 || val > 31)) {
-          resultType = 9;  // error
-          break;
-        }
-
-        tmp << std::setw(resultType == 0 ? 4 : 2) << std::dec << val;
-        newValue += tmp.str().substr(0, resultType == 0 ? 4 : 2) + '-';
-        tmp.seekp(0);
-        resultType++;
-        last = next + 1;
-      }
-      if (resultType > 3) {
-        // Invalid length
-        continue;
-      }
-      std::string typeString[3] = {IRI__XSD__YEAR, IRI__XSD__YEAR_MONTH,
-                                   IRI__XSD__DATE};
-      _writer->writeTriple(
-          subj, _writer->generateIRIUnsafe(NAMESPACE__OSM2RDF_TAG, key),
-          _writer->generateLiteralUnsafe(
-              newValue.substr(0, newValue.size() - 1),
-              "^^" + typeString[resultType - 1]));
+    if (info.type == TagType::DATE) {
+      writeDateTag(subj, info, value);
     }
   }
   if (tagTripleCount > 0 || _config.addZeroFactNumber) {
-    _writer->writeTriple(subj, _tagTripleCountIRI,
-                         _writer->generateLiteralUnsafe(
-                             std::to_string(tagTripleCount), _iriXSDInteger));
+    _writer->writeIntegerLiteralTriple(subj, _tagTripleCountIRI,
+                                       tagTripleCount);
   }
 }
 
@@ -822,3 +979,4 @@ bool osm2rdf::osm::FactHandler<W>::hasSuffix(const std::string& subj,
 template class osm2rdf::osm::FactHandler<osm2rdf::ttl::format::NT>;
 template class osm2rdf::osm::FactHandler<osm2rdf::ttl::format::TTL>;
 template class osm2rdf::osm::FactHandler<osm2rdf::ttl::format::QLEVER>;
+template class osm2rdf::osm::FactHandler<osm2rdf::ttl::format::BINARY>;
@@ -20,22 +20,34 @@
 
 #include "osm2rdf/osm/GeometryHandler.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <vector>
 
 #include "osm2rdf/config/Config.h"
+#include "osm2rdf/config/Constants.h"
 #include "osm2rdf/osm/Area.h"
 #include "osm2rdf/osm/Constants.h"
 #include "osm2rdf/osm/FactHandler.h"
 #include "osm2rdf/ttl/Constants.h"
 #include "osm2rdf/ttl/Writer.h"
+#include "osm2rdf/util/AuxGeoCache.h"
+#include "osm2rdf/util/DirectedAcyclicGraph.h"
+#include "osm2rdf/util/DirectedGraph.h"
 #include "osm2rdf/util/ProgressBar.h"
+#include "osm2rdf/util/Projection.h"
 #include "osm2rdf/util/Time.h"
 #include "spatialjoin/BoxIds.h"
 #include "spatialjoin/Sweeper.h"
@@ -82,7 +94,10 @@ GeometryHandler<W>::GeometryHandler(const osm2rdf::config::Config& config,
                 true,
                 true,
                 false,
-                false,
+                // conservative inner/outer simplified geometries as a
+                // pre-filter, exact geometries are only checked if the
+                // simplified ones are inconclusive
+                config.simplifyGeometries,
                 -1,
                 false,
                 [this](size_t t, const char* a, size_t an, const char* b,
@@ -94,9 +109,29 @@ GeometryHandler<W>::GeometryHandler(const osm2rdf::config::Config& config,
                 [this](size_t progr) { this->progressCb(progr); },
                 {}},
                config.cache, ""),
-      _parseBatches(config.numThreads) {
+      _parseBatches(config.numThreads),
+      _geomBuffers(config.numThreads),
+      _stripeLeftIds(config.numThreads),
+      _containsEdges(config.numThreads) {
   _separateUntaggedNodePrefixes = _config.iriPrefixForUntaggedNodes !=
                                   IRI_PREFIX_NODE_TAGGED[_config.sourceDataset];
+
+  if (_config.numSpatialStripes > 0) {
+    _striped = true;
+    const double width = 360.0 / _config.numSpatialStripes;
+    if (_config.spatialStripe > 0) {
+      _stripeMinX =
+          transform(::util::geo::DPoint{-180.0 + width * _config.spatialStripe,
+                                        0})
+              .getX();
+    }
+    if (_config.spatialStripe + 1 < _config.numSpatialStripes) {
+      _stripeMaxX = transform(::util::geo::DPoint{
+                                  -180.0 + width * (_config.spatialStripe + 1),
+                                  0})
+                        .getX();
+    }
+  }
 }
 
 // ___________________________________________________________________________
@@ -118,6 +153,10 @@ void GeometryHandler<W>::relation(const Relation& rel) {
   if (!rel.hasGeometry()) return;
 
   const std::string id = getSweeperId(rel.id(), 3);
+  // bounding box of the whole relation, shared by all members
+  const auto box = transform(rel.envelope());
+
+  if (!inStripe(box, id)) return;
 
   size_t subId = 0;
 
@@ -135,14 +174,14 @@ void GeometryHandler<W>::relation(const Relation& rel) {
         pid = getSweeperId(m.positive_ref(), 5);
       }
 
-      _sweeper.add(pid, transform(::util::geo::getBoundingBox(rel.geom())), id,
-                   subId, false, _parseBatches[omp_get_thread_num()]);
+      _sweeper.add(pid, box, id, subId, false,
+                   _parseBatches[omp_get_thread_num()]);
     }
 
     if (m.type() == osmium::item_type::way) {
       std::string pid = getSweeperId(m.positive_ref(), 2);
-      _sweeper.add(pid, transform(::util::geo::getBoundingBox(rel.geom())), id,
-                   subId, false, _parseBatches[omp_get_thread_num()]);
+      _sweeper.add(pid, box, id, subId, false,
+                   _parseBatches[omp_get_thread_num()]);
     }
 
     subId++;
@@ -159,10 +198,103 @@ template <typename W>
 void GeometryHandler<W>::writeRelCb(size_t t, const char* a, size_t an,
                                     const char* b, size_t bn, const char* pred,
                                     size_t predn) {
+  if (_striped) {
+    // A relation belongs to the stripe containing the left border of the
+    // intersection of both bounding boxes. If both geometries start left of
+    // this stripe, the relation is written by a stripe further left.
+    const auto& left = _stripeLeftIds[0];
+    if (left.count(std::string(a, an)) && left.count(std::string(b, bn))) {
+      return;
+    }
+  }
+  if (_config.reduceContains &&
+      std::string_view(pred, predn) ==
+          osm2rdf::ttl::constants::IRI__OPENGIS__CONTAINS) {
+    uint64_t src;
+    uint64_t dst;
+    if (getContainsKey(a, an, &src) && getContainsKey(b, bn, &dst)) {
+      _containsEdges[t].emplace_back(src, dst);
+      return;
+    }
+  }
   _writer->writeTriple(getFullID(a, an), std::string(pred, predn),
                        getFullID(b, bn), t);
 }
 
+// ____________________________________________________________________________
+template <typename W>
+bool GeometryHandler<W>::getContainsKey(const char* id, size_t n,
+                                        uint64_t* key) {
+  if (n == 0 || n > 9 || id[0] < 1 || id[0] > 5) return false;
+  uint64_t oid = 0;
+  for (size_t i = 1; i < n; i++) {
+    oid = (oid << 8) | static_cast<unsigned char>(id[i]);
+  }
+  if (oid >> 61) return false;
+  *key = (oid << 3) | static_cast<uint64_t>(id[0]);
+  return true;
+}
+
+// ____________________________________________________________________________
+template <typename W>
+void GeometryHandler<W>::writeReducedContains() {
+  std::vector<std::pair<uint64_t, uint64_t>> edges;
+  size_t numEdges = 0;
+  for (const auto& e : _containsEdges) numEdges += e.size();
+  edges.reserve(numEdges);
+  for (auto& e : _containsEdges) {
+    edges.insert(edges.end(), e.begin(), e.end());
+    e = {};
+  }
+
+  // sorted for the lookup of reverse edges below
+  std::sort(edges.begin(), edges.end());
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+  std::cerr << osm2rdf::util::currentTimeFormatted()
+            << "Reducing " << edges.size() << " contains relations ..."
+            << std::endl;
+
+  osm2rdf::util::DirectedGraph<uint64_t> graph;
+  std::vector<std::pair<uint64_t, uint64_t>> equal;
+  for (const auto& [src, dst] : edges) {
+    // geometries containing each other are equal, only keep one direction
+    // in the graph to keep it acyclic and write the other one directly
+    if (src > dst &&
+        std::binary_search(edges.begin(), edges.end(), std::pair{dst, src})) {
+      equal.emplace_back(src, dst);
+      continue;
+    }
+    graph.addEdge(src, dst);
+  }
+  edges = {};
+  graph.freeze();
+
+  // the contains relations from the sweeper are transitively closed
+  auto reduced = osm2rdf::util::reduceMaximalConnectedDAG(graph, true);
+  graph = {};
+
+  for (const auto& [src, dst] : equal) reduced.addEdge(src, dst);
+  reduced.freeze();
+
+  const auto vertices = reduced.getVertices();
+#pragma omp parallel for
+  for (size_t i = 0; i < vertices.size(); i++) {
+    const auto srcId = getSweeperId(vertices[i] >> 3, vertices[i] & 7);
+    const auto srcIRI = getFullID(srcId.data(), srcId.size());
+    for (const auto& dst : reduced.getEdges(vertices[i])) {
+      const auto dstId = getSweeperId(dst >> 3, dst & 7);
+      _writer->writeTriple(srcIRI,
+                           osm2rdf::ttl::constants::IRI__OPENGIS__CONTAINS,
+                           getFullID(dstId.data(), dstId.size()),
+                           omp_get_thread_num());
+    }
+  }
+
+  std::cerr << osm2rdf::util::currentTimeFormatted() << "... done, wrote "
+            << reduced.getNumEdges() << " contains relations" << std::endl;
+}
+
 // ____________________________________________________________________________
 template <typename W>
 void GeometryHandler<W>::progressCb(size_t prog) {
@@ -178,52 +310,67 @@ template <typename W>
 
 // ____________________________________________________________________________
 template <typename W>
-::util::geo::I32Line GeometryHandler<W>::transform(
-    const ::util::geo::DLine& way) {
-  ::util::geo::I32Line l;
-
-  l.reserve(way.size());
-
-  for (const auto& loc : way) {
-    l.push_back(transform(loc));
+void GeometryHandler<W>::transform(const osmium::NodeRefList& nodes,
+                                   bool skipInvalid, std::vector<double>* lngLat,
+                                   ::util::geo::I32Line* out) {
+  lngLat->clear();
+  lngLat->reserve(nodes.size() * 2);
+
+  osmium::Location last;
+  for (const auto& nodeRef : nodes) {
+    const auto& loc = nodeRef.location();
+    if (skipInvalid) {
+      // same as osm2rdf::osm::Way, drop invalid and repeated locations
+      if (!loc.valid() || loc == last) continue;
+      last = loc;
+      lngLat->push_back(loc.lon_without_check());
+      lngLat->push_back(loc.lat_without_check());
+    } else {
+      // throws osmium::invalid_location, same as osm2rdf::osm::Area
+      lngLat->push_back(loc.lon());
+      lngLat->push_back(loc.lat());
+    }
   }
 
-  return l;
+  out->resize(lngLat->size() / 2);
+  osm2rdf::util::projectWebMercBatch(lngLat->data(), out->data(), out->size(),
+                                     PREC);
 }
 
 // ____________________________________________________________________________
 template <typename W>
-::util::geo::I32MultiPolygon GeometryHandler<W>::transform(
-    const ::util::geo::DMultiPolygon& area) {
-  ::util::geo::I32MultiPolygon p(area.size());
-
-  for (size_t i = 0; i < area.size(); i++) {
-    p[i].getOuter().reserve(area[i].getOuter().size());
-
-    for (const auto& loc : area[i].getOuter()) {
-      p[i].getOuter().push_back(transform(loc));
+void GeometryHandler<W>::area(const osmium::Area& area) {
+  const std::string id = getSweeperId(
+      static_cast<osm2rdf::osm::Area::id_t>(area.orig_id()),
+      area.from_way() ? 2 : 3);
+
+  auto& buf = _geomBuffers[omp_get_thread_num()];
+  auto& poly = buf.multiPolygon;
+  ::util::geo::I32Box box;
+
+  const auto& outerRings = area.outer_rings();
+  poly.resize(outerRings.size());
+  size_t oCount = 0;
+  for (const auto& oring : outerRings) {
+    transform(oring, false, &buf.lngLat, &poly[oCount].getOuter());
+    for (const auto& p : poly[oCount].getOuter()) {
+      box = ::util::geo::extendBox(p, box);
     }
 
-    p[i].getInners().resize(area[i].getInners().size());
-
-    for (size_t j = 0; j < area[i].getInners().size(); j++) {
-      p[i].getInners()[j].reserve(area[i].getInners()[j].size());
-      for (const auto& loc : area[i].getInners()[j]) {
-        p[i].getInners()[j].push_back(transform(loc));
-      }
+    const auto& innerRings = area.inner_rings(oring);
+    poly[oCount].getInners().resize(innerRings.size());
+    size_t iCount = 0;
+    for (const auto& iring : innerRings) {
+      transform(iring, false, &buf.lngLat,
+                &poly[oCount].getInners()[iCount]);
+      iCount++;
     }
+    oCount++;
   }
 
-  return p;
-}
-
-// ____________________________________________________________________________
-template <typename W>
-void GeometryHandler<W>::area(const Area& area) {
-  const std::string id = getSweeperId(area.objId(), area.fromWay() ? 2 : 3);
+  if (!inStripe(box, id)) return;
 
-  _sweeper.add(transform(area.geom()), id, false,
-               _parseBatches[omp_get_thread_num()]);
+  _sweeper.add(poly, id, false, _parseBatches[omp_get_thread_num()]);
 
   if (_parseBatches[omp_get_thread_num()].size() > BATCH_SIZE) {
     _sweeper.addBatch(_parseBatches[omp_get_thread_num()]);
@@ -256,9 +403,12 @@ void GeometryHandler<W>::node(const osmium::Node& node) {
     id = getSweeperId(node.id(), 5);
   }
 
-  _sweeper.add(transform(::util::geo::DPoint{node.location().lon(),
-                                             node.location().lat()}),
-               id, false, _parseBatches[omp_get_thread_num()]);
+  const auto point = transform(
+      ::util::geo::DPoint{node.location().lon(), node.location().lat()});
+
+  if (!inStripe({point, point}, id)) return;
+
+  _sweeper.add(point, id, false, _parseBatches[omp_get_thread_num()]);
 
   if (_parseBatches[omp_get_thread_num()].size() > BATCH_SIZE) {
     _sweeper.addBatch(_parseBatches[omp_get_thread_num()]);
@@ -268,13 +418,23 @@ void GeometryHandler<W>::node(const osmium::Node& node) {
 
 // ____________________________________________________________________________
 template <typename W>
-void GeometryHandler<W>::way(const Way& way) {
-  if (way.isArea()) return;  // skip way relations, will be handled by area()
+void GeometryHandler<W>::way(const osmium::Way& way) {
+  // skip way relations, will be handled by area()
+  if (osm2rdf::osm::Way::isArea(way)) return;
 
   std::string id = getSweeperId(way.id(), 2);
 
-  _sweeper.add(transform(way.geom()), id, false,
-               _parseBatches[omp_get_thread_num()]);
+  auto& buf = _geomBuffers[omp_get_thread_num()];
+  transform(way.nodes(), true, &buf.lngLat, &buf.line);
+
+  ::util::geo::I32Box box;
+  for (const auto& p : buf.line) {
+    box = ::util::geo::extendBox(p, box);
+  }
+
+  if (!inStripe(box, id)) return;
+
+  _sweeper.add(buf.line, id, false, _parseBatches[omp_get_thread_num()]);
 
   if (_parseBatches[omp_get_thread_num()].size() > BATCH_SIZE) {
     _sweeper.addBatch(_parseBatches[omp_get_thread_num()]);
@@ -291,39 +451,222 @@ void GeometryHandler<W>::calculateRelations() {
     b = {};
   }
 
+  // merge ids of geometries reaching over the left stripe border
+  for (size_t i = 1; i < _stripeLeftIds.size(); i++) {
+    _stripeLeftIds[0].merge(_stripeLeftIds[i]);
+    _stripeLeftIds[i] = {};
+  }
+
   // read optional auxiliary geo data
+  std::vector<std::string> wktFiles;
   for (const auto& auxFile : _config.auxGeoFiles) {
     if (auxFile.size() == 0) continue;
-    const static size_t CACHE_SIZE = 1024 * 1024 * 100;
-    unsigned char* buf = new unsigned char[CACHE_SIZE];
 
-    auto file = open(auxFile.c_str(), O_RDONLY);
+    if (osm2rdf::util::AuxGeoCache::isCacheFile(auxFile)) {
+      addAuxGeoCache(auxFile);
+      continue;
+    }
+
+    if (_config.auxGeoFilesCache) {
+      const auto cacheFile =
+          osm2rdf::util::AuxGeoCache::cachePath(_config.cache, auxFile);
+      if (!osm2rdf::util::AuxGeoCache::isCacheFile(cacheFile) ||
+          std::filesystem::last_write_time(cacheFile) <
+              std::filesystem::last_write_time(auxFile)) {
+        std::cerr << osm2rdf::util::currentTimeFormatted()
+                  << "Converting auxiliary geo file " << auxFile << " ..."
+                  << std::endl;
+        try {
+          osm2rdf::util::AuxGeoCache::convert(
+              auxFile, cacheFile,
+              [](const ::util::geo::DPoint& p) { return transform(p); });
+        } catch (const std::runtime_error& e) {
+          // e.g. geometry types the cache does not support, parse as WKT
+          std::cerr << osm2rdf::util::currentTimeFormatted()
+                    << "Could not convert auxiliary geo file, reading it "
+                       "without cache: "
+                    << e.what() << std::endl;
+          std::filesystem::remove(cacheFile);
+          wktFiles.push_back(auxFile);
+          continue;
+        }
+      }
+      addAuxGeoCache(cacheFile);
+      continue;
+    }
 
-    if (file < 0) {
-      delete[] buf;
+    wktFiles.push_back(auxFile);
+  }
+
+  addAuxWKTFiles(wktFiles);
+
+  _sweeper.flush();
+
+  _progressBar = osm2rdf::util::ProgressBar{_sweeper.numElements(), true};
+
+  _sweeper.sweep();
+
+  _progressBar.done();
+
+  if (_config.reduceContains) writeReducedContains();
+}
+
+// ____________________________________________________________________________
+template <typename W>
+void GeometryHandler<W>::addAuxWKTFiles(const std::vector<std::string>& files) {
+  const static size_t MIN_CHUNK_SIZE = 1024 * 1024;
+  const static size_t MAX_CHUNK_SIZE = 1024 * 1024 * 100;
+
+  // chunk of a mapped file, always ending after a newline or at the file end
+  struct Chunk {
+    char* start;
+    size_t len;
+    size_t file;
+    // number of lines, and the first line without an id (1-based, 0 if none)
+    size_t lines = 0;
+    size_t missingId = 0;
+  };
+
+  std::vector<std::pair<char*, size_t>> maps;
+  std::vector<Chunk> chunks;
+
+  for (size_t fileId = 0; fileId < files.size(); fileId++) {
+    const auto& auxFile = files[fileId];
+    int file = open(auxFile.c_str(), O_RDONLY);
+
+    struct stat st;
+    if (file < 0 || fstat(file, &st) != 0) {
+      if (file >= 0) close(file);
+      for (const auto& m : maps) munmap(m.first, m.second);
       throw std::runtime_error("Could not read auxiliary geo file " + auxFile);
     }
 
-    sj::WKTParser parser(&_sweeper, _config.numThreads);
+    const size_t size = st.st_size;
+    if (size == 0) {
+      close(file);
+      continue;
+    }
+
+    // private writable mapping, the parser may modify the buffer in place
+    void* data =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+    close(file);
+
+    if (data == MAP_FAILED) {
+      for (const auto& m : maps) munmap(m.first, m.second);
+      throw std::runtime_error("Could not map auxiliary geo file " + auxFile);
+    }
 
-    ssize_t len;
+    madvise(data, size, MADV_SEQUENTIAL);
+    maps.emplace_back(static_cast<char*>(data), size);
+
+    // split into at least one chunk per thread at line boundaries
+    const size_t chunkSize =
+        std::clamp(size / _config.numThreads + 1, MIN_CHUNK_SIZE,
+                   MAX_CHUNK_SIZE);
+    char* c = static_cast<char*>(data);
+    size_t pos = 0;
+    while (pos < size) {
+      size_t end = std::min(pos + chunkSize, size);
+      if (end < size) {
+        const char* nl =
+            static_cast<const char*>(memchr(c + end, '\n', size - end));
+        end = nl == nullptr ? size : nl - c + 1;
+      }
+      chunks.push_back({c + pos, end - pos, fileId});
+      pos = end;
+    }
+  }
 
-    while ((len = ::util::readAll(file, buf, CACHE_SIZE)) > 0) {
-      parser.parse(reinterpret_cast<char*>(buf), len, 0);
+#pragma omp parallel for schedule(dynamic, 1)
+  for (size_t i = 0; i < chunks.size(); i++) {
+    // the parser numbers lines without an id per chunk, so these ids would
+    // not be unique, require an explicit id on every line instead
+    auto& chunk = chunks[i];
+    const char* c = chunk.start;
+    const char* end = chunk.start + chunk.len;
+    while (c < end) {
+      const char* nl = static_cast<const char*>(memchr(c, '\n', end - c));
+      const char* lineEnd = nl == nullptr ? end : nl;
+      chunk.lines++;
+      if (lineEnd != c && memchr(c, '\t', lineEnd - c) == nullptr) {
+        chunk.missingId = chunk.lines;
+        break;
+      }
+      c = lineEnd + 1;
     }
+    if (chunk.missingId != 0) continue;
 
+    sj::WKTParser parser(&_sweeper, 1);
+    parser.parse(chunk.start, chunk.len, 0);
     parser.done();
+  }
 
-    delete[] buf;
+  for (const auto& m : maps) munmap(m.first, m.second);
+
+  size_t lineOffset = 0;
+  for (size_t i = 0; i < chunks.size(); i++) {
+    if (i > 0 && chunks[i].file != chunks[i - 1].file) lineOffset = 0;
+    if (chunks[i].missingId != 0) {
+      throw std::runtime_error(
+          "Line " + std::to_string(lineOffset + chunks[i].missingId) +
+          " of auxiliary geo file " + files[chunks[i].file] +
+          " has no id, expected <id>\\t<WKT>");
+    }
+    lineOffset += chunks[i].lines;
   }
+}
 
-  _sweeper.flush();
+// ____________________________________________________________________________
+template <typename W>
+void GeometryHandler<W>::addAuxGeoCache(const std::filesystem::path& path) {
+  const osm2rdf::util::AuxGeoCache cache{path};
+
+#pragma omp parallel for schedule(dynamic, BATCH_SIZE)
+  for (size_t i = 0; i < cache.size(); i++) {
+    auto& batch = _parseBatches[omp_get_thread_num()];
+    const std::string id{cache.id(i)};
+
+    switch (cache.type(i)) {
+      case osm2rdf::util::AuxGeoType::POINT:
+        _sweeper.add(cache.point(i), id, false, batch);
+        break;
+      case osm2rdf::util::AuxGeoType::LINE:
+        _sweeper.add(cache.line(i), id, false, batch);
+        break;
+      case osm2rdf::util::AuxGeoType::MULTIPOLYGON:
+        _sweeper.add(cache.multiPolygon(i), id, false, batch);
+        break;
+    }
 
-  _progressBar = osm2rdf::util::ProgressBar{_sweeper.numElements(), true};
+    if (batch.size() > BATCH_SIZE) {
+      _sweeper.addBatch(batch);
+      batch = {};
+    }
+  }
 
-  _sweeper.sweep();
+  for (auto& b : _parseBatches) {
+    _sweeper.addBatch(b);
+    b = {};
+  }
+}
 
-  _progressBar.done();
+// ____________________________________________________________________________
+template <typename W>
+bool GeometryHandler<W>::inStripe(const ::util::geo::I32Box& box,
+                                  const std::string& id) {
+  if (!_striped) return true;
+
+  if (box.getUpperRight().getX() < _stripeMinX ||
+      box.getLowerLeft().getX() >= _stripeMaxX) {
+    return false;
+  }
+
+  if (box.getLowerLeft().getX() < _stripeMinX) {
+    _stripeLeftIds[omp_get_thread_num()].insert(id);
+  }
+
+  return true;
 }
 
 // ____________________________________________________________________________
@@ -392,3 +735,4 @@ std::string GeometryHandler<W>::getSweeperId(uint64_t oid, char type) {
 template class osm2rdf::osm::GeometryHandler<osm2rdf::ttl::format::NT>;
 template class osm2rdf::osm::GeometryHandler<osm2rdf::ttl::format::TTL>;
 template class osm2rdf::osm::GeometryHandler<osm2rdf::ttl::format::QLEVER>;
+template class osm2rdf::osm::GeometryHandler<osm2rdf::ttl::format::BINARY>;
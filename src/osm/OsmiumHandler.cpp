@@ -44,7 +44,10 @@ osm2rdf::osm::OsmiumHandler<W>::OsmiumHandler(
     : _config(config),
       _factHandler(factHandler),
       _geometryHandler(geomHandler),
-      _relationHandler(osm2rdf::osm::RelationHandler(config)) {}
+      _relationHandler(osm2rdf::osm::RelationHandler(config)),
+      _areas(config.numThreads),
+      _relations(config.numThreads),
+      _ways(config.numThreads) {}
 
 // ____________________________________________________________________________
 template <typename W>
@@ -201,15 +204,17 @@ void osm2rdf::osm::OsmiumHandler<W>::area(const osmium::Area& area) {
   }
 
   try {
-    auto osmArea = osm2rdf::osm::Area(area);
-    osmArea.finalize();
+    // the double geometry is only needed for the facts, the geometry
+    // handler projects the osmium locations directly
     if (!_config.noFacts && !_config.noAreaFacts) {
+      auto& osmArea = _areas[omp_get_thread_num()];
+      osmArea.reset(area);
       _areasDumped++;
       _factHandler->area(osmArea);
     }
     if (!_config.noGeometricRelations && !_config.noAreaGeometricRelations) {
       _areaGeometriesHandled++;
-      _geometryHandler->area(osmArea);
+      _geometryHandler->area(area);
     }
   } catch (const osmium::invalid_location& e) {
     return;
@@ -296,7 +301,8 @@ void osm2rdf::osm::OsmiumHandler<W>::relation(
   try {
     // only task this away if we actually build the relation geometries,
     // otherwise this just adds multithreading overhead for nothing
-    auto osmRelation = osm2rdf::osm::Relation(relation);
+    auto& osmRelation = _relations[omp_get_thread_num()];
+    osmRelation.reset(relation);
     if (!osmRelation.isArea() && _relationHandler.hasLocationHandler()) {
       osmRelation.buildGeometry(_relationHandler);
     }
@@ -342,15 +348,16 @@ void osm2rdf::osm::OsmiumHandler<W>::way(osmium::Way& way) {
     return;
   }
 
-	auto osmWay = osm2rdf::osm::Way(way);
 	if (!_config.noFacts && !_config.noWayFacts) {
+		auto& osmWay = _ways[omp_get_thread_num()];
+		osmWay.reset(way);
 		_factHandler->way(osmWay);
 		_waysDumped++;
 		_numTasksDone += way.nodes().size();
 	}
 
 	if (!_config.noGeometricRelations && !_config.noWayGeometricRelations) {
-		_geometryHandler->way(osmWay);
+		_geometryHandler->way(way);
 		_wayGeometriesHandled++;
 		_numTasksDone += way.nodes().size();
 	}
@@ -438,3 +445,4 @@ size_t osm2rdf::osm::OsmiumHandler<W>::wayGeometriesHandled() const {
 template class osm2rdf::osm::OsmiumHandler<osm2rdf::ttl::format::NT>;
 template class osm2rdf::osm::OsmiumHandler<osm2rdf::ttl::format::TTL>;
 template class osm2rdf::osm::OsmiumHandler<osm2rdf::ttl::format::QLEVER>;
+template class osm2rdf::osm::OsmiumHandler<osm2rdf::ttl::format::BINARY>;
@@ -30,9 +30,19 @@
 osm2rdf::osm::Relation::Relation() { _hasCompleteGeometry = false; }
 
 // ____________________________________________________________________________
-osm2rdf::osm::Relation::Relation(const osmium::Relation& relation)
-    : _r(&relation) {
+osm2rdf::osm::Relation::Relation(const osmium::Relation& relation) {
+  reset(relation);
+}
+
+// ____________________________________________________________________________
+void osm2rdf::osm::Relation::reset(const osmium::Relation& relation) {
+  _r = &relation;
   _hasCompleteGeometry = false;
+  _geom.clear();
+  _envelope = ::util::geo::DBox();
+  _centroid.reset();
+  _convexHull.reset();
+  _obb.reset();
 
   auto typeTag = relation.tags()["type"];
   _isArea = typeTag != nullptr && (strcmp(typeTag, "multipolygon") == 0 ||
@@ -93,10 +103,40 @@ const ::util::geo::DCollection& osm2rdf::osm::Relation::geom() const noexcept {
   return _geom;
 }
 
+// ____________________________________________________________________________
+const ::util::geo::DBox& osm2rdf::osm::Relation::envelope() const noexcept {
+  return _envelope;
+}
+
+// ____________________________________________________________________________
+const ::util::geo::DPoint& osm2rdf::osm::Relation::centroid() const noexcept {
+  if (!_centroid) _centroid = ::util::geo::centroid(_geom);
+  return *_centroid;
+}
+
+// ____________________________________________________________________________
+const ::util::geo::DPolygon& osm2rdf::osm::Relation::convexHull()
+    const noexcept {
+  if (!_convexHull) _convexHull = ::util::geo::convexHull(_geom);
+  return *_convexHull;
+}
+
+// ____________________________________________________________________________
+const ::util::geo::DPolygon& osm2rdf::osm::Relation::orientedBoundingBox()
+    const noexcept {
+  if (!_obb) {
+    _obb = ::util::geo::convexHull(::util::geo::getOrientedEnvelope(_geom));
+  }
+  return *_obb;
+}
+
 // ____________________________________________________________________________
 void osm2rdf::osm::Relation::buildGeometry(
     osm2rdf::osm::RelationHandler& relationHandler) {
   _hasCompleteGeometry = true;
+  _centroid.reset();
+  _convexHull.reset();
+  _obb.reset();
   for (const auto& member : _r->members()) {
     if (member.type() == osmium::item_type::way) {
       const auto& nodeRefs =
@@ -105,23 +145,26 @@ void osm2rdf::osm::Relation::buildGeometry(
         _hasCompleteGeometry = false;
       }
 
-      ::util::geo::DLine way;
-      way.reserve(nodeRefs.size());
+      _wayLine.clear();
+      _wayLine.reserve(nodeRefs.size());
       for (const auto& nodeRef : nodeRefs) {
         const auto& res = relationHandler.get_node_location(nodeRef);
         if (res.valid()) {
-          way.push_back({res.lon(), res.lat()});
+          _wayLine.push_back({res.lon(), res.lat()});
+          _envelope = ::util::geo::extendBox(_wayLine.back(), _envelope);
         } else {
           _hasCompleteGeometry = false;
         }
       }
 
-      if (way.size() > 0) _geom.push_back(way);
+      if (!_wayLine.empty()) _geom.push_back(_wayLine);
     } else if (member.type() == osmium::item_type::node) {
       const auto& res =
           relationHandler.get_node_location(member.positive_ref());
       if (res.valid()) {
-        _geom.push_back(::util::geo::DPoint{res.lon(), res.lat()});
+        const ::util::geo::DPoint point{res.lon(), res.lat()};
+        _envelope = ::util::geo::extendBox(point, _envelope);
+        _geom.push_back(point);
       } else {
         _hasCompleteGeometry = false;
       }
@@ -30,7 +30,30 @@
 osm2rdf::osm::Way::Way() {}
 
 // ____________________________________________________________________________
-osm2rdf::osm::Way::Way(const osmium::Way& way) : _w(&way) {}
+osm2rdf::osm::Way::Way(const osmium::Way& way) { reset(way); }
+
+// ____________________________________________________________________________
+void osm2rdf::osm::Way::reset(const osmium::Way& way) {
+  _w = &way;
+  _geom.clear();
+  _envelope = ::util::geo::DBox();
+  _length.reset();
+  _centroid.reset();
+  _convexHull.reset();
+  _obb.reset();
+
+  _geom.reserve(way.nodes().size());
+  for (const auto& nodeRef : way.nodes()) {
+    if (!nodeRef.location().valid()) continue;
+    if (_geom.empty() ||
+        (nodeRef.location().lon_without_check() != _geom.back().getX() ||
+         nodeRef.location().lat_without_check() != _geom.back().getY())) {
+      _geom.push_back({nodeRef.location().lon_without_check(),
+                       nodeRef.location().lat_without_check()});
+      _envelope = ::util::geo::extendBox(_geom.back(), _envelope);
+    }
+  }
+}
 
 // ____________________________________________________________________________
 osm2rdf::osm::Way::id_t osm2rdf::osm::Way::id() const noexcept {
@@ -73,44 +96,72 @@ const osmium::WayNodeList& osm2rdf::osm::Way::nodes() const noexcept {
 }
 
 // ____________________________________________________________________________
-const ::util::geo::DLine osm2rdf::osm::Way::geom() const noexcept {
-  ::util::geo::DLine ret;
-  for (const auto& nodeRef : _w->nodes()) {
-    if (!nodeRef.location().valid()) continue;
-    if (ret.empty() ||
-        (nodeRef.location().lon_without_check() != ret.back().getX() ||
-         nodeRef.location().lat_without_check() != ret.back().getY())) {
-      ret.push_back({nodeRef.location().lon_without_check(),
-                     nodeRef.location().lat_without_check()});
-    }
+const ::util::geo::DLine& osm2rdf::osm::Way::geom() const noexcept {
+  return _geom;
+}
+
+// ____________________________________________________________________________
+const ::util::geo::DBox& osm2rdf::osm::Way::envelope() const noexcept {
+  return _envelope;
+}
+
+// ____________________________________________________________________________
+double osm2rdf::osm::Way::length() const noexcept {
+  if (!_length) _length = ::util::geo::latLngLen(_geom);
+  return *_length;
+}
+
+// ____________________________________________________________________________
+const ::util::geo::DPoint& osm2rdf::osm::Way::centroid() const noexcept {
+  if (!_centroid) _centroid = ::util::geo::centroid(_geom);
+  return *_centroid;
+}
+
+// ____________________________________________________________________________
+const ::util::geo::DPolygon& osm2rdf::osm::Way::convexHull() const noexcept {
+  if (!_convexHull) _convexHull = ::util::geo::convexHull(_geom);
+  return *_convexHull;
+}
+
+// ____________________________________________________________________________
+const ::util::geo::DPolygon& osm2rdf::osm::Way::orientedBoundingBox()
+    const noexcept {
+  if (!_obb) {
+    _obb = ::util::geo::convexHull(::util::geo::getOrientedEnvelope(_geom));
   }
-  return ret;
+  return *_obb;
 }
 
 // ____________________________________________________________________________
-bool osm2rdf::osm::Way::closed() const noexcept {
-  return _w->nodes().size() > 1 && _w->nodes().front().location().valid() &&
-         _w->nodes().back().location().valid() &&
-         _w->nodes().front().location().lon_without_check() ==
-             _w->nodes().back().location().lon_without_check() &&
-         _w->nodes().front().location().lat_without_check() ==
-             _w->nodes().back().location().lat_without_check();
+bool osm2rdf::osm::Way::closed() const noexcept { return closed(*_w); }
+
+// ____________________________________________________________________________
+bool osm2rdf::osm::Way::closed(const osmium::Way& way) noexcept {
+  return way.nodes().size() > 1 && way.nodes().front().location().valid() &&
+         way.nodes().back().location().valid() &&
+         way.nodes().front().location().lon_without_check() ==
+             way.nodes().back().location().lon_without_check() &&
+         way.nodes().front().location().lat_without_check() ==
+             way.nodes().back().location().lat_without_check();
 }
 
 // ____________________________________________________________________________
-bool osm2rdf::osm::Way::isArea() const noexcept {
+bool osm2rdf::osm::Way::isArea() const noexcept { return isArea(*_w); }
+
+// ____________________________________________________________________________
+bool osm2rdf::osm::Way::isArea(const osmium::Way& way) noexcept {
   // See libosmium/include/osmium/area/multipolygon_manager.hpp:154
-  if (_w->nodes().size() < 4) {
+  if (way.nodes().size() < 4) {
     return false;
   }
-  if (!closed()) {
+  if (!closed(way)) {
     return false;
   }
-  if (_w->tags().has_tag("area", "no")) {
+  if (way.tags().has_tag("area", "no")) {
     return false;
   }
 
-  if (osmium::tags::match_none_of(_w->tags(), osmium::TagsFilter{true})) {
+  if (osmium::tags::match_none_of(way.tags(), osmium::TagsFilter{true})) {
     return false;
   }
 
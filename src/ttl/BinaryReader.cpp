@@ -0,0 +1,248 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "osm2rdf/ttl/BinaryReader.h"
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+
+// ____________________________________________________________________________
+osm2rdf::ttl::BinaryReader::BinaryReader(std::istream* in) : _in(in) {}
+
+// ____________________________________________________________________________
+bool osm2rdf::ttl::BinaryReader::next() {
+  while (true) {
+    const auto c = _in->get();
+    if (c == std::istream::traits_type::eof()) {
+      return false;
+    }
+    switch (static_cast<binary::Record>(c)) {
+      case binary::Record::MAGIC: {
+        // Start of a (concatenated) stream
+        std::string magic(binary::MAGIC.size() - 1, '\0');
+        if (!_in->read(magic.data(), magic.size()) ||
+            magic != binary::MAGIC.substr(1)) {
+          throw std::runtime_error("Invalid binary stream header");
+        }
+        _hasMagic = true;
+        _prefixes.clear();
+        break;
+      }
+      case binary::Record::PREFIX: {
+        if (!_hasMagic) {
+          throw std::runtime_error("Binary stream without header");
+        }
+        const uint64_t id = readVarint();
+        if (id >= _prefixes.size()) {
+          _prefixes.resize(id + 1);
+        }
+        readString(&_prefixes[id]);
+        break;
+      }
+      case binary::Record::TRIPLE:
+        if (!_hasMagic) {
+          throw std::runtime_error("Binary stream without header");
+        }
+        readTerm(0);
+        readTerm(1);
+        readTerm(2);
+        return true;
+      default:
+        throw std::runtime_error("Unknown record type " + std::to_string(c) +
+                                 " in binary stream");
+    }
+  }
+}
+
+// ____________________________________________________________________________
+const osm2rdf::ttl::BinaryTerm& osm2rdf::ttl::BinaryReader::term(
+    size_t i) const {
+  return _terms[i];
+}
+
+// ____________________________________________________________________________
+uint8_t osm2rdf::ttl::BinaryReader::readByte() {
+  const auto c = _in->get();
+  if (c == std::istream::traits_type::eof()) {
+    throw std::runtime_error("Unexpected end of binary stream");
+  }
+  return static_cast<uint8_t>(c);
+}
+
+// ____________________________________________________________________________
+uint64_t osm2rdf::ttl::BinaryReader::readVarint() {
+  uint64_t v = 0;
+  for (size_t shift = 0; shift < 7 * binary::MAX_VARINT_LENGTH; shift += 7) {
+    const uint8_t c = readByte();
+    v |= static_cast<uint64_t>(c & 0x7F) << shift;
+    if ((c & 0x80) == 0) {
+      return v;
+    }
+  }
+  throw std::runtime_error("Invalid varint in binary stream");
+}
+
+// ____________________________________________________________________________
+void osm2rdf::ttl::BinaryReader::readString(std::string* buf) {
+  buf->resize(readVarint());
+  if (!_in->read(buf->data(), buf->size())) {
+    throw std::runtime_error("Unexpected end of binary stream");
+  }
+}
+
+// ____________________________________________________________________________
+void osm2rdf::ttl::BinaryReader::readIRI(std::string* buf) {
+  switch (static_cast<binary::Term>(readByte())) {
+    case binary::Term::IRI:
+      readString(buf);
+      return;
+    case binary::Term::PREFIXED: {
+      const auto& p = prefix(readVarint());
+      readString(buf);
+      buf->insert(0, p);
+      return;
+    }
+    case binary::Term::PREFIXED_ID: {
+      *buf = prefix(readVarint());
+      *buf += std::to_string(readVarint());
+      return;
+    }
+    default:
+      throw std::runtime_error("Expected IRI in binary stream");
+  }
+}
+
+// ____________________________________________________________________________
+void osm2rdf::ttl::BinaryReader::readTerm(size_t i) {
+  BinaryTerm& term = _terms[i];
+  std::string& value = _values[i];
+  std::string& extra = _extras[i];
+  term = {};
+  term.type = static_cast<binary::Term>(readByte());
+  switch (term.type) {
+    case binary::Term::IRI:
+    case binary::Term::BLANK_NODE:
+    case binary::Term::LITERAL:
+    case binary::Term::NT:
+      readString(&value);
+      break;
+    case binary::Term::PREFIXED:
+      term.prefix = prefix(readVarint());
+      readString(&value);
+      break;
+    case binary::Term::PREFIXED_ID: {
+      term.prefix = prefix(readVarint());
+      term.id = readVarint();
+      char buf[20];
+      const auto res = std::to_chars(buf, buf + sizeof(buf), term.id);
+      value.assign(buf, res.ptr - buf);
+      break;
+    }
+    case binary::Term::TYPED_LITERAL:
+      readString(&value);
+      readIRI(&extra);
+      term.datatype = extra;
+      break;
+    case binary::Term::LANG_LITERAL:
+      readString(&value);
+      readString(&extra);
+      term.lang = extra;
+      break;
+    case binary::Term::INTEGER:
+      term.integer = binary::decodeZigZag(readVarint());
+      return;
+    default:
+      throw std::runtime_error(
+          "Unknown term type " + std::to_string(static_cast<int>(term.type)) +
+          " in binary stream");
+  }
+  term.value = value;
+}
+
+// ____________________________________________________________________________
+const std::string& osm2rdf::ttl::BinaryReader::prefix(uint64_t id) const {
+  if (id >= _prefixes.size()) {
+    throw std::runtime_error("Unknown prefix " + std::to_string(id) +
+                             " in binary stream");
+  }
+  return _prefixes[id];
+}
+
+// ____________________________________________________________________________
+void osm2rdf::ttl::BinaryReader::writeTriple(Writer<format::NT>* writer,
+                                             size_t part) const {
+  writeTerm(_terms[0], writer, part);
+  writer->write(' ', part);
+  writeTerm(_terms[1], writer, part);
+  writer->write(' ', part);
+  writeTerm(_terms[2], writer, part);
+  writer->writeTripleEnd(part);
+}
+
+// ____________________________________________________________________________
+void osm2rdf::ttl::BinaryReader::writeTerm(const BinaryTerm& term,
+                                           Writer<format::NT>* writer,
+                                           size_t part) {
+  // IRIs and literals are stored raw, the writer encodes them
+  switch (term.type) {
+    case binary::Term::IRI:
+      writer->writeIRIREF({term.value}, part);
+      break;
+    case binary::Term::PREFIXED:
+    case binary::Term::PREFIXED_ID:
+      writer->writeIRIREF({term.prefix, term.value}, part);
+      break;
+    case binary::Term::BLANK_NODE:
+      writer->write("_:", part);
+      writer->write(term.value, part);
+      break;
+    case binary::Term::LITERAL:
+      writer->writeLiteral(term.value, part);
+      break;
+    case binary::Term::TYPED_LITERAL:
+      writer->writeLiteral(term.value, part);
+      writer->write("^^", part);
+      writer->writeIRIREF({term.datatype}, part);
+      break;
+    case binary::Term::LANG_LITERAL:
+      writer->writeLiteral(term.value, part);
+      writer->write('@', part);
+      writer->write(term.lang, part);
+      break;
+    case binary::Term::INTEGER:
+      writer->writeIntegerLiteral(term.integer, part);
+      break;
+    case binary::Term::NT:
+      writer->write(term.value, part);
+      break;
+  }
+}
+
+// ____________________________________________________________________________
+size_t osm2rdf::ttl::BinaryReader::convert(std::istream* in,
+                                           Writer<format::NT>* writer) {
+  BinaryReader reader{in};
+  size_t count = 0;
+  while (reader.next()) {
+    reader.writeTriple(writer, 0);
+    count++;
+  }
+  return count;
+}
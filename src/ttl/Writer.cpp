@@ -20,17 +20,22 @@
 #include "osm2rdf/ttl/Writer.h"
 
 #include <algorithm>
+#include <charconv>
 #include <iomanip>
 #include <iostream>
 #include <string>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #if defined(_OPENMP)
 #include "omp.h"
 #endif
 #include "osm2rdf/Version.h"
 #include "osm2rdf/config/Config.h"
+#include "osm2rdf/ttl/Binary.h"
 #include "osm2rdf/ttl/Constants.h"
+#include "osm2rdf/util/Scan.h"
 #include "osm2rdf/util/Time.h"
 #include "osmium/osm/item_type.hpp"
 
@@ -40,7 +45,7 @@ osm2rdf::ttl::Writer<T>::Writer(const osm2rdf::config::Config& config,
                                 osm2rdf::util::Output* output)
     : _config(config), _out(output) {
   // Static prefixes
-  _prefixes = {
+  const std::vector<std::pair<std::string, std::string>> prefixes = {
       // well-known prefixes
       {osm2rdf::ttl::constants::NAMESPACE__GEOSPARQL,
        "http://www.opengis.net/ont/geosparql#"},
@@ -102,6 +107,14 @@ osm2rdf::ttl::Writer<T>::Writer(const osm2rdf::config::Config& config,
       {osm2rdf::ttl::constants::NAMESPACE__OHM_CHANGESET,
        "https://www.openhistoricalmap.org/changeset/"},
   };
+  for (const auto& [prefix, iri] : prefixes) {
+    addPrefix(prefix, iri);
+  }
+  if (_config.skolemizeMembers) {
+    addPrefix(osm2rdf::ttl::constants::NAMESPACE__OSM2RDF_MEMBER,
+              "https://osm2rdf.cs.uni-freiburg.de/rdf/member#");
+  }
+  _xsdPrefix = prefixId(osm2rdf::ttl::constants::NAMESPACE__XML_SCHEMA);
 
   // Generate constants
   osm2rdf::ttl::constants::IRI__GEOSPARQL__AS_WKT =
@@ -220,6 +233,12 @@ osm2rdf::ttl::Writer<T>::Writer(const osm2rdf::config::Config& config,
   _blankNodeCount = new uint64_t[_numOuts];
   _headerLines = new uint64_t[_numOuts];
   _lineCount = new uint64_t[_numOuts];
+  _timeFormatters = new osm2rdf::util::ISOTimeFormatter[_numOuts];
+  _openSubjects = new std::string[_numOuts];
+  _rawObjects = new std::string[_numOuts];
+  _groupSubjects = _config.outputGroupSubjects &&
+                   (std::is_same_v<T, osm2rdf::ttl::format::TTL> ||
+                    std::is_same_v<T, osm2rdf::ttl::format::QLEVER>);
   for (size_t i = 0; i < _numOuts; ++i) {
     _blankNodeCount[i] = 0;
     _headerLines[i] = 0;
@@ -233,26 +252,83 @@ osm2rdf::ttl::Writer<T>::~Writer() {
   delete[] _blankNodeCount;
   delete[] _headerLines;
   delete[] _lineCount;
+  delete[] _timeFormatters;
+  delete[] _openSubjects;
+  delete[] _rawObjects;
 }
 
 // ____________________________________________________________________________
 template <typename T>
 bool osm2rdf::ttl::Writer<T>::addPrefix(const std::string& prefix,
                                         std::string_view value) {
-  auto prefixIt = _prefixes.find(prefix);
-  if (prefixIt != _prefixes.end()) {
+  if (findPrefix(prefix) != nullptr) {
     return false;
   }
-  _prefixes[prefix] = value;
+  _prefixes.push_back({prefix, std::string{value}, "", ""});
+  renderPrefix(&_prefixes.back());
+  _prefixIds[_prefixes.back().name] =
+      static_cast<PrefixId>(_prefixes.size() - 1);
+  _prefixIriIds.emplace(_prefixes.back().iri,
+                        static_cast<PrefixId>(_prefixes.size() - 1));
+  const auto& iri = _prefixes.back().iri;
+  if (!iri.empty() && _prefixIriEnds.find(iri.back()) == std::string::npos) {
+    _prefixIriEnds += iri.back();
+  }
   return true;
 }
 
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT>::renderPrefix(
+    Prefix* prefix) {
+  // NT:  [8]    IRIREF
+  //      https://www.w3.org/TR/n-triples/#grammar-production-IRIREF
+  prefix->begin = "<" + prefix->iri;
+  prefix->end = ">";
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::renderPrefix(
+    Prefix* prefix) {
+  // Generated terms are formatted like NT and split up again when written
+  prefix->begin = "<" + prefix->iri;
+  prefix->end = ">";
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::renderPrefix(Prefix* prefix) {
+  // TTL: [136s] PrefixedName
+  //      https://www.w3.org/TR/turtle/#grammar-production-PrefixedName
+  prefix->begin = prefix->name + ":";
+  prefix->end = "";
+}
+
+// ____________________________________________________________________________
+template <typename T>
+const typename osm2rdf::ttl::Writer<T>::Prefix*
+osm2rdf::ttl::Writer<T>::findPrefix(std::string_view p) const {
+  auto prefixId = _prefixIds.find(p);
+  if (prefixId == _prefixIds.end()) {
+    return nullptr;
+  }
+  return &_prefixes[prefixId->second];
+}
+
+// ____________________________________________________________________________
+template <typename T>
+osm2rdf::ttl::PrefixId osm2rdf::ttl::Writer<T>::prefixId(
+    std::string_view p) const {
+  return _prefixIds.at(p);
+}
+
 // ____________________________________________________________________________
 template <typename T>
 std::string osm2rdf::ttl::Writer<T>::resolvePrefix(std::string_view p) {
-  auto prefix = _prefixes.find(std::string{p});
-  if (prefix != _prefixes.end()) {
-    return prefix->second;
+  const auto* prefix = findPrefix(p);
+  if (prefix != nullptr) {
+    return prefix->iri;
   }
   return std::string(p);
 }
@@ -285,8 +361,15 @@ void osm2rdf::ttl::Writer<T>::writeStatisticJson(
 // ____________________________________________________________________________
 template <typename T>
 void osm2rdf::ttl::Writer<T>::writeHeader() {
-  for (const auto& [prefix, iriref] : _prefixes) {
-    writeTriple("@prefix", prefix + ":", "<" + iriref + ">", 0);
+  // Written directly, prefix declarations are never grouped by subject
+  for (const auto& prefix : _prefixes) {
+    _out->write("@prefix ", 0);
+    _out->write(prefix.name, 0);
+    _out->write(": <", 0);
+    _out->write(prefix.iri, 0);
+    _out->write("> .", 0);
+    _out->writeNewLine(0);
+    _lineCount[0]++;
     _headerLines[0]++;
   }
   _out->flush();
@@ -296,6 +379,21 @@ void osm2rdf::ttl::Writer<T>::writeHeader() {
 template <>
 void osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT>::writeHeader() {}
 
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeHeader() {
+  _out->write(binary::MAGIC, 0);
+  for (size_t i = 0; i < _prefixes.size(); ++i) {
+    _out->write(static_cast<char>(binary::Record::PREFIX), 0);
+    writeVarint(i, 0);
+    writeBinaryString(_prefixes[i].iri, 0);
+    _out->writeRecordEnd(0);
+    _lineCount[0]++;
+    _headerLines[0]++;
+  }
+  _out->flush();
+}
+
 // ____________________________________________________________________________
 template <typename T>
 void osm2rdf::ttl::Writer<T>::writeMetadata() {
@@ -370,10 +468,20 @@ void osm2rdf::ttl::Writer<T>::writeMetadata() {
   writeOptionTriple(
       osm2rdf::config::constants::ADD_WAY_NODE_SPATIAL_METADATA_OPTION_LONG,
       generateBooleanLiteral(_config.addWayNodeSpatialMetadata));
+  writeOptionTriple(osm2rdf::config::constants::SKOLEMIZE_MEMBERS_OPTION_LONG,
+                    generateBooleanLiteral(_config.skolemizeMembers));
   writeOptionTriple(osm2rdf::config::constants::SKIP_WIKI_LINKS_OPTION_LONG,
                     generateBooleanLiteral(_config.skipWikiLinks));
   writeOptionTriple(osm2rdf::config::constants::SIMPLIFY_GEOMETRIES_OPTION_LONG,
                     generateBooleanLiteral(_config.simplifyGeometries));
+  writeOptionTriple(osm2rdf::config::constants::REDUCE_CONTAINS_OPTION_LONG,
+                    generateBooleanLiteral(_config.reduceContains));
+  if (_config.numSpatialStripes > 0) {
+    writeOptionTriple(
+        osm2rdf::config::constants::SPATIAL_STRIPE_OPTION_LONG,
+        generateLiteral(std::to_string(_config.spatialStripe) + "/" +
+                        std::to_string(_config.numSpatialStripes)));
+  }
   writeOptionTriple(osm2rdf::config::constants::SIMPLIFY_WKT_OPTION_LONG,
                     generateLiteral(std::to_string(_config.simplifyWKT),
                                     "^^" + constants::IRI__XSD__INTEGER));
@@ -418,19 +526,57 @@ void osm2rdf::ttl::Writer<T>::writeOptionTriple(const std::string& optionName,
 // ____________________________________________________________________________
 template <typename T>
 std::string osm2rdf::ttl::Writer<T>::generateBlankNode() {
+  return std::string(std::string_view(newBlankNode()));
+}
+
+// ____________________________________________________________________________
+template <typename T>
+osm2rdf::ttl::BlankNode osm2rdf::ttl::Writer<T>::newBlankNode() {
   int threadId = 0;
 #if defined(_OPENMP)
   threadId = omp_get_thread_num();
 #endif
-  return "_:" + std::to_string(threadId) + "_" +
-         std::to_string(_blankNodeCount[threadId]++);
+  return {static_cast<uint64_t>(threadId), _blankNodeCount[threadId]++};
 }
 
 // ____________________________________________________________________________
 template <typename T>
 void osm2rdf::ttl::Writer<T>::writeIRI(std::string_view p, uint64_t v,
                                        size_t part) {
-  writeIRIUnsafe(p, std::to_string(v), part);
+  char buf[20];
+  const auto res = std::to_chars(buf, buf + sizeof(buf), v);
+  writeIRIUnsafe(p, std::string_view(buf, res.ptr - buf), part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeIRI(PrefixId p, uint64_t v, size_t part) {
+  char buf[20];
+  const auto res = std::to_chars(buf, buf + sizeof(buf), v);
+  writeIRIUnsafe(p, std::string_view(buf, res.ptr - buf), part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeIRI(
+    PrefixId p, uint64_t v, size_t part) {
+  writeBinaryTag(binary::Term::PREFIXED_ID, part);
+  writeVarint(p, part);
+  writeVarint(v, part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeIRI(
+    std::string_view p, uint64_t v, size_t part) {
+  auto prefixId = _prefixIds.find(p);
+  if (prefixId != _prefixIds.end()) {
+    writeIRI(prefixId->second, v, part);
+    return;
+  }
+  char buf[20];
+  const auto res = std::to_chars(buf, buf + sizeof(buf), v);
+  writeIRIUnsafe(p, std::string_view(buf, res.ptr - buf), part);
 }
 
 // ____________________________________________________________________________
@@ -440,6 +586,25 @@ void osm2rdf::ttl::Writer<T>::writeIRIUnsafe(std::string_view p,
   writeFormattedIRIUnsafe(p, v, part);
 }
 
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeIRIUnsafe(PrefixId p, std::string_view v,
+                                             size_t part) {
+  const auto& prefix = _prefixes[p];
+  _out->write(prefix.begin, part);
+  _out->write(v, part);
+  _out->write(prefix.end, part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeIRIUnsafe(
+    PrefixId p, std::string_view v, size_t part) {
+  writeBinaryTag(binary::Term::PREFIXED, part);
+  writeVarint(p, part);
+  writeBinaryString(v, part);
+}
+
 // ____________________________________________________________________________
 template <typename T>
 void osm2rdf::ttl::Writer<T>::writeIRI(std::string_view p, std::string_view v,
@@ -464,6 +629,61 @@ std::string osm2rdf::ttl::Writer<T>::generateIRI(std::string_view p,
   return generateIRIUnsafe(p, std::to_string(v));
 }
 
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::generateIRIUnsafe(PrefixId p, std::string_view v,
+                                                uint64_t id,
+                                                std::string* buf) {
+  const auto& prefix = _prefixes[p];
+  char digits[20];
+  const auto res = std::to_chars(digits, digits + sizeof(digits), id);
+  buf->assign(prefix.begin);
+  buf->append(v);
+  buf->append(digits, res.ptr - digits);
+  buf->append(prefix.end);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::generateIRIUnsafe(
+    PrefixId p, std::string_view v, uint64_t id, std::string* buf) {
+  // Encoded term, written as it is by writeTerm
+  char tmp[binary::MAX_VARINT_LENGTH];
+  buf->clear();
+  if (v.empty()) {
+    buf->push_back(static_cast<char>(binary::Term::PREFIXED_ID));
+    buf->append(tmp, binary::encodeVarint(p, tmp));
+    buf->append(tmp, binary::encodeVarint(id, tmp));
+    return;
+  }
+  char digits[20];
+  const auto res = std::to_chars(digits, digits + sizeof(digits), id);
+  buf->push_back(static_cast<char>(binary::Term::PREFIXED));
+  buf->append(tmp, binary::encodeVarint(p, tmp));
+  buf->append(tmp,
+              binary::encodeVarint(v.size() + (res.ptr - digits), tmp));
+  buf->append(v);
+  buf->append(digits, res.ptr - digits);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+std::string osm2rdf::ttl::Writer<T>::generateIRIUnsafe(PrefixId p,
+                                                       std::string_view v,
+                                                       uint64_t id) {
+  std::string res;
+  generateIRIUnsafe(p, v, id, &res);
+  return res;
+}
+
+// ____________________________________________________________________________
+template <typename T>
+std::string osm2rdf::ttl::Writer<T>::generateIRI(PrefixId p, uint64_t v) {
+  std::string res;
+  generateIRIUnsafe(p, "", v, &res);
+  return res;
+}
+
 // ____________________________________________________________________________
 template <typename T>
 std::string osm2rdf::ttl::Writer<T>::generateIRIUnsafe(std::string_view p,
@@ -507,187 +727,761 @@ std::string osm2rdf::ttl::Writer<T>::generateLangTag(std::string_view s) {
       break;
     }
   }
-  if (!ok) {
-    throw std::domain_error("Invalid LangTag s: '" + std::string{s});
+  if (!ok) {
+    throw std::domain_error("Invalid LangTag s: '" + std::string{s});
+  }
+  std::string tmp = "@";
+  tmp.reserve(s.size() + 1);
+  tmp += s;
+  return tmp;
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeLiteral(std::string_view v, size_t part) {
+  // NT:  [9]   STRING_LITERAL_QUOTE
+  //      https://www.w3.org/TR/n-triples/#grammar-production-STRING_LITERAL_QUOTE
+  // TTL: [22]  STRING_LITERAL_QUOTE
+  //      https://www.w3.org/TR/turtle/#grammar-production-STRING_LITERAL_QUOTE
+  _out->write('"', part);
+  // copy runs without special chars in bulk
+  size_t pos;
+  while ((pos = osm2rdf::util::findLiteralEscape(v)) != v.size()) {
+    _out->write(v.substr(0, pos), part);
+    switch (v[pos]) {
+      case '\"':  // #x22
+        _out->write("\\\"", part);
+        break;
+      case '\\':  // #x5C
+        _out->write("\\\\", part);
+        break;
+      case '\n':  // #x0A
+        _out->write("\\n", part);
+        break;
+      case '\r':  // #x0D
+        _out->write("\\r", part);
+        break;
+    }
+    v.remove_prefix(pos + 1);
+  }
+  _out->write(v, part);
+  _out->write('"', part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeLiteral(
+    std::string_view v, size_t part) {
+  writeBinaryTag(binary::Term::LITERAL, part);
+  writeBinaryString(v, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeLiteralStart() {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeLiteralStart(part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeLiteralStart(size_t part) {
+  _out->write('"', part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeLiteralStart(
+    [[maybe_unused]] size_t part) {}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeLiteralEnd(PrefixId p,
+                                              std::string_view v) {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeLiteralEnd(p, v, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeLiteralEnd(PrefixId p, std::string_view v,
+                                              size_t part) {
+  _out->write("\"^^", part);
+  writeIRIUnsafe(p, v, part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeLiteralEnd(
+    PrefixId p, std::string_view v, size_t part) {
+  // The lexical form was collected by write()
+  writeBinaryTag(binary::Term::TYPED_LITERAL, part);
+  writeBinaryString(_rawObjects[part], part);
+  _rawObjects[part].clear();
+  writeIRIUnsafe(p, v, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeIntegerLiteral(int64_t v, size_t part) {
+  char buf[20];
+  const auto res = std::to_chars(buf, buf + sizeof(buf), v);
+  _out->write('"', part);
+  _out->write(std::string_view(buf, res.ptr - buf), part);
+  _out->write("\"^^", part);
+  _out->write(constants::IRI__XSD__INTEGER, part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeIntegerLiteral(
+    int64_t v, size_t part) {
+  writeBinaryTag(binary::Term::INTEGER, part);
+  writeVarint(binary::encodeZigZag(v), part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeLiteralUnsafe(std::string_view v,
+                                                 std::string_view s,
+                                                 size_t part) {
+  // only put literal in quotes
+  _out->write('"', part);
+  _out->write(v, part);
+  _out->write('"', part);
+  _out->write(s, part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeLiteralUnsafe(
+    std::string_view v, std::string_view s, size_t part) {
+  if (!writeBinaryLiteral(v, s, part)) {
+    writeBinaryTag(binary::Term::NT, part);
+    writeBinaryString("\"" + std::string{v} + "\"" + std::string{s}, part);
+  }
+}
+
+// ____________________________________________________________________________
+template <typename T>
+std::string osm2rdf::ttl::Writer<T>::generateLiteral(std::string_view v) {
+  return STRING_LITERAL_QUOTE(v);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+std::string osm2rdf::ttl::Writer<T>::generateBooleanLiteral(const bool& b) {
+  return b ? constants::LITERAL__TRUE : constants::LITERAL__FALSE;
+}
+
+// ____________________________________________________________________________
+template <typename T>
+std::string osm2rdf::ttl::Writer<T>::generateLiteral(std::string_view v,
+                                                     std::string_view s) {
+  return STRING_LITERAL_QUOTE(v) + std::string{s};
+}
+
+// ____________________________________________________________________________
+template <typename T>
+std::string osm2rdf::ttl::Writer<T>::generateLiteralUnsafe(std::string_view v,
+                                                           std::string_view s) {
+  // only put literal in quotes
+  std::string ret;
+  ret.reserve(v.size() + 2 + s.size());
+  ret += '"';
+  ret += v;
+  ret += '"';
+  ret += s;
+
+  return ret;
+}
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeUnsafeIRILiteralTriple(const char* s,
+                                                          const char* p,
+                                                          const char* v,
+                                                          const char* o) {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeUnsafeIRILiteralTriple(s, p, v, o, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeUnsafeIRILiteralTriple(
+    const char* s, const char* p, const char* v, const char* o, size_t part) {
+  writeSubject(s, part);
+  writeIRIUnsafe(p, v, part);
+  writeSeparator(part);
+  writeLiteral(o, part);
+  writeTripleEnd(part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeUnsafeIRILiteralTriple(std::string_view s,
+                                                          PrefixId p,
+                                                          std::string_view v,
+                                                          std::string_view o) {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeSubject(s, part);
+  writeIRIUnsafe(p, v, part);
+  writeSeparator(part);
+  writeLiteral(o, part);
+  writeTripleEnd(part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeIRILiteralTriple(const std::string& s,
+                                                    const std::string& p,
+                                                    const std::string& v,
+                                                    const std::string& o) {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#else
+  part = 0;
+#endif
+
+  writeIRILiteralTriple(s, p, v, o, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeIRILiteralTriple(const std::string& s,
+                                                    const std::string& p,
+                                                    const std::string& v,
+                                                    const std::string& o,
+                                                    size_t part) {
+  writeSubject(s, part);
+  writeIRI(p, v, part);
+  writeSeparator(part);
+  writeLiteral(o, part);
+  writeTripleEnd(part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeTriple(std::string_view s,
+                                          std::string_view p,
+                                          std::string_view o) {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeTriple(s, p, o, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeTriple(std::string_view s,
+                                          std::string_view p,
+                                          std::string_view o, size_t part) {
+  writeTripleStart(s, p, part);
+  writeTerm(o, part);
+  writeTripleEnd(part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeTripleStart(std::string_view s,
+                                               std::string_view p) {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeTripleStart(s, p, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeTripleStart(std::string_view s,
+                                               std::string_view p,
+                                               size_t part) {
+  writeSubject(s, part);
+  writeTerm(p, part);
+  writeSeparator(part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeSubject(std::string_view s, size_t part) {
+  if (_groupSubjects) {
+    std::string& openSubject = _openSubjects[part];
+    if (!openSubject.empty()) {
+      if (openSubject == s) {
+        // Continue the open statement with the next predicate
+        _out->write(" ;", part);
+        _out->writeNewLine(part);
+        _out->write('\t', part);
+        return;
+      }
+      _out->write(" .", part);
+      _out->writeNewLine(part);
+    }
+    openSubject.assign(s);
+  }
+  _out->write(s, part);
+  _out->write(' ', part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeTerm(std::string_view t, size_t part) {
+  _out->write(t, part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeTerm(
+    std::string_view t, size_t part) {
+  // Terms from generateIRIUnsafe(PrefixId, ...) are already encoded
+  if (!t.empty() && static_cast<uint8_t>(t[0]) <=
+                        static_cast<uint8_t>(binary::Term::NT)) {
+    _out->write(t, part);
+    return;
+  }
+  std::string unescaped;
+  if (t.size() >= 2 && t.front() == '<' && t.back() == '>') {
+    auto iri = t.substr(1, t.size() - 2);
+    if (iri.find('\\') == std::string_view::npos) {
+      writeBinaryIRI(iri, part);
+      return;
+    }
+    if (unescapeTerm(iri, &unescaped)) {
+      writeBinaryIRI(unescaped, part);
+      return;
+    }
+  } else if (t.size() > 2 && t[0] == '_' && t[1] == ':') {
+    writeBinaryTag(binary::Term::BLANK_NODE, part);
+    writeBinaryString(t.substr(2), part);
+    return;
+  } else if (t.size() >= 2 && t.front() == '"') {
+    const auto end = t.rfind('"');
+    if (end > 0) {
+      auto v = t.substr(1, end - 1);
+      // Escape sequences are replaced, literals are stored raw
+      bool valid = true;
+      if (v.find('\\') != std::string_view::npos) {
+        valid = unescapeTerm(v, &unescaped);
+        v = unescaped;
+      }
+      if (valid && writeBinaryLiteral(v, t.substr(end + 1), part)) {
+        return;
+      }
+    }
+  }
+  writeBinaryTag(binary::Term::NT, part);
+  writeBinaryString(t, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+bool osm2rdf::ttl::Writer<T>::unescapeTerm(std::string_view s,
+                                           std::string* res) {
+  // NT:  [10]  UCHAR, [153s] ECHAR
+  res->clear();
+  res->reserve(s.size());
+  size_t pos;
+  while ((pos = s.find('\\')) != std::string_view::npos) {
+    res->append(s.substr(0, pos));
+    if (pos + 1 == s.size()) {
+      return false;
+    }
+    const char c = s[pos + 1];
+    s.remove_prefix(pos + 2);
+    switch (c) {
+      case 't':
+        res->push_back('\t');
+        continue;
+      case 'b':
+        res->push_back('\b');
+        continue;
+      case 'n':
+        res->push_back('\n');
+        continue;
+      case 'r':
+        res->push_back('\r');
+        continue;
+      case 'f':
+        res->push_back('\f');
+        continue;
+      case '"':
+      case '\'':
+      case '\\':
+        res->push_back(c);
+        continue;
+      case 'u':
+      case 'U':
+        break;
+      default:
+        return false;
+    }
+    const size_t n = c == 'u' ? UTF8_BYTES_SHORT : UTF8_BYTES_LONG;
+    uint32_t cp;
+    if (s.size() < n ||
+        std::from_chars(s.data(), s.data() + n, cp, 16).ptr != s.data() + n) {
+      return false;
+    }
+    s.remove_prefix(n);
+    // UTF-8 encoding of the codepoint
+    if (cp < 0x80) {
+      res->push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+      res->push_back(static_cast<char>(0xC0 | (cp >> 6)));
+      res->push_back(static_cast<char>(0x80 | (cp & k0x3F)));
+    } else if (cp < k0x10000) {
+      res->push_back(static_cast<char>(0xE0 | (cp >> 12)));
+      res->push_back(static_cast<char>(0x80 | ((cp >> 6) & k0x3F)));
+      res->push_back(static_cast<char>(0x80 | (cp & k0x3F)));
+    } else if (cp <= 0x10FFFF) {
+      res->push_back(static_cast<char>(0xF0 | (cp >> 18)));
+      res->push_back(static_cast<char>(0x80 | ((cp >> 12) & k0x3F)));
+      res->push_back(static_cast<char>(0x80 | ((cp >> 6) & k0x3F)));
+      res->push_back(static_cast<char>(0x80 | (cp & k0x3F)));
+    } else {
+      return false;
+    }
+  }
+  res->append(s);
+  return true;
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeSubject(
+    std::string_view s, size_t part) {
+  _out->write(static_cast<char>(binary::Record::TRIPLE), part);
+  writeTerm(s, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeSeparator(size_t part) {
+  _out->write(' ', part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeSeparator(
+    [[maybe_unused]] size_t part) {}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeVarint(uint64_t v, size_t part) {
+  char buf[binary::MAX_VARINT_LENGTH];
+  _out->write(std::string_view(buf, binary::encodeVarint(v, buf)), part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeBinaryString(std::string_view s,
+                                                size_t part) {
+  writeVarint(s.size(), part);
+  _out->write(s, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeBinaryTag(binary::Term tag, size_t part) {
+  _out->write(static_cast<char>(tag), part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeBinaryIRI(std::string_view iri,
+                                             size_t part) {
+  // Split at the last characters of the prefix IRIs, longest prefix first.
+  // Not all of them end in '/' or '#', e.g. osmkey: ends in "Key:".
+  auto pos = iri.find_last_of(_prefixIriEnds);
+  for (; pos != std::string_view::npos;
+       pos = pos == 0 ? std::string_view::npos
+                      : iri.find_last_of(_prefixIriEnds, pos - 1)) {
+    const auto prefix = _prefixIriIds.find(iri.substr(0, pos + 1));
+    if (prefix != _prefixIriIds.end()) {
+      const auto local = iri.substr(pos + 1);
+      // Only canonical decimals are written as ID, "007" stays as it is
+      uint64_t id;
+      if (!local.empty() && (local[0] != '0' || local.size() == 1)) {
+        const auto res =
+            std::from_chars(local.data(), local.data() + local.size(), id);
+        if (res.ec == std::errc() && res.ptr == local.data() + local.size()) {
+          writeBinaryTag(binary::Term::PREFIXED_ID, part);
+          writeVarint(prefix->second, part);
+          writeVarint(id, part);
+          return;
+        }
+      }
+      writeBinaryTag(binary::Term::PREFIXED, part);
+      writeVarint(prefix->second, part);
+      writeBinaryString(local, part);
+      return;
+    }
+  }
+  writeBinaryTag(binary::Term::IRI, part);
+  writeBinaryString(iri, part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+bool osm2rdf::ttl::Writer<T>::writeBinaryLiteral(std::string_view v,
+                                                 std::string_view suffix,
+                                                 size_t part) {
+  if (suffix.empty()) {
+    writeBinaryTag(binary::Term::LITERAL, part);
+    writeBinaryString(v, part);
+    return true;
+  }
+  if (suffix.size() > 4 && suffix.substr(0, 3) == "^^<" &&
+      suffix.back() == '>' &&
+      suffix.find('\\') == std::string_view::npos) {
+    writeBinaryTag(binary::Term::TYPED_LITERAL, part);
+    writeBinaryString(v, part);
+    writeBinaryIRI(suffix.substr(3, suffix.size() - 4), part);
+    return true;
+  }
+  if (suffix.size() > 1 && suffix[0] == '@') {
+    writeBinaryTag(binary::Term::LANG_LITERAL, part);
+    writeBinaryString(v, part);
+    writeBinaryString(suffix.substr(1), part);
+    return true;
+  }
+  return false;
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeTripleEnd() {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeTripleEnd(part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeTripleEnd(size_t part) {
+  // The terminator of a grouped triple is written by the next triple or
+  // closeStatements, the line is counted now
+  if (!_groupSubjects) {
+    _out->write(" .", part);
+    _out->writeNewLine(part);
+  }
+  _lineCount[part]++;
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeTripleEnd(
+    size_t part) {
+  // Object written in pieces with write()
+  if (!_rawObjects[part].empty()) {
+    writeTerm(_rawObjects[part], part);
+    _rawObjects[part].clear();
   }
-  std::string tmp = "@";
-  tmp.reserve(s.size() + 1);
-  tmp += s;
-  return tmp;
+  _out->writeRecordEnd(part);
+  _lineCount[part]++;
 }
 
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeLiteral(std::string_view v, size_t part) {
-  // NT:  [9]   STRING_LITERAL_QUOTE
-  //      https://www.w3.org/TR/n-triples/#grammar-production-STRING_LITERAL_QUOTE
-  // TTL: [22]  STRING_LITERAL_QUOTE
-  //      https://www.w3.org/TR/turtle/#grammar-production-STRING_LITERAL_QUOTE
-  _out->write('"', part);
-  for (const auto c : v) {
-    switch (c) {
-      case '\"':  // #x22
-        _out->write("\\\"", part);
-        break;
-      case '\\':  // #x5C
-        _out->write("\\\\", part);
-        break;
-      case '\n':  // #x0A
-        _out->write("\\n", part);
-        break;
-      case '\r':  // #x0D
-        _out->write("\\r", part);
-        break;
-      default:
-        _out->write(c, part);
+void osm2rdf::ttl::Writer<T>::closeStatements() {
+  for (size_t part = 0; part < _numOuts; ++part) {
+    if (_openSubjects[part].empty()) {
+      continue;
     }
+    _out->write(" .", part);
+    _out->writeNewLine(part);
+    _openSubjects[part].clear();
   }
-  _out->write('"', part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeLiteralUnsafe(std::string_view v,
-                                                 std::string_view s,
-                                                 size_t part) {
-  // only put literal in quotes
-  _out->write('"', part);
-  _out->write(v, part);
-  _out->write('"', part);
-  _out->write(s, part);
+void osm2rdf::ttl::Writer<T>::writeIRITriple(std::string_view s,
+                                             std::string_view p,
+                                             std::string_view prefix,
+                                             uint64_t id) {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeIRITriple(s, p, prefix, id, part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-std::string osm2rdf::ttl::Writer<T>::generateLiteral(std::string_view v) {
-  return STRING_LITERAL_QUOTE(v);
+void osm2rdf::ttl::Writer<T>::writeIRITriple(std::string_view s,
+                                             std::string_view p,
+                                             std::string_view prefix,
+                                             uint64_t id, size_t part) {
+  writeTripleStart(s, p, part);
+  writeIRI(prefix, id, part);
+  writeTripleEnd(part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-std::string osm2rdf::ttl::Writer<T>::generateBooleanLiteral(const bool& b) {
-  return b ? constants::LITERAL__TRUE : constants::LITERAL__FALSE;
+void osm2rdf::ttl::Writer<T>::writeIRITriple(std::string_view s,
+                                             std::string_view p,
+                                             PrefixId prefix, uint64_t id) {
+  size_t part = 0;
+
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeIRITriple(s, p, prefix, id, part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-std::string osm2rdf::ttl::Writer<T>::generateLiteral(std::string_view v,
-                                                     std::string_view s) {
-  return STRING_LITERAL_QUOTE(v) + std::string{s};
+void osm2rdf::ttl::Writer<T>::writeIRITriple(std::string_view s,
+                                             std::string_view p,
+                                             PrefixId prefix, uint64_t id,
+                                             size_t part) {
+  writeTripleStart(s, p, part);
+  writeIRI(prefix, id, part);
+  writeTripleEnd(part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-std::string osm2rdf::ttl::Writer<T>::generateLiteralUnsafe(std::string_view v,
-                                                           std::string_view s) {
-  // only put literal in quotes
-  std::string ret;
-  ret.reserve(v.size() + 2 + s.size());
-  ret += '"';
-  ret += v;
-  ret += '"';
-  ret += s;
+void osm2rdf::ttl::Writer<T>::writeIRITripleUnsafe(std::string_view s,
+                                                   std::string_view p,
+                                                   PrefixId prefix,
+                                                   std::string_view v) {
+  size_t part = 0;
 
-  return ret;
+#if defined(_OPENMP)
+  part = omp_get_thread_num();
+#endif
+
+  writeIRITripleUnsafe(s, p, prefix, v, part);
 }
+
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeUnsafeIRILiteralTriple(const char* s,
-                                                          const char* p,
-                                                          const char* v,
-                                                          const char* o) {
+void osm2rdf::ttl::Writer<T>::writeIRITripleUnsafe(std::string_view s,
+                                                   std::string_view p,
+                                                   PrefixId prefix,
+                                                   std::string_view v,
+                                                   size_t part) {
+  writeTripleStart(s, p, part);
+  writeIRIUnsafe(prefix, v, part);
+  writeTripleEnd(part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeIRIREFTriple(
+    std::string_view s, std::string_view p,
+    std::initializer_list<std::string_view> parts) {
   size_t part = 0;
 
 #if defined(_OPENMP)
   part = omp_get_thread_num();
 #endif
 
-  writeUnsafeIRILiteralTriple(s, p, v, o, part);
+  writeIRIREFTriple(s, p, parts, part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeUnsafeIRILiteralTriple(
-    const char* s, const char* p, const char* v, const char* o, size_t part) {
-  _out->write(s, part);
-  _out->write(' ', part);
-  writeIRIUnsafe(p, v, part);
-  _out->write(' ', part);
-  writeLiteral(o, part);
-  _out->write(" .", part);
-  _out->writeNewLine(part);
-  _lineCount[part]++;
+void osm2rdf::ttl::Writer<T>::writeIRIREFTriple(
+    std::string_view s, std::string_view p,
+    std::initializer_list<std::string_view> parts, size_t part) {
+  writeTripleStart(s, p, part);
+  writeIRIREF(parts, part);
+  writeTripleEnd(part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeIRILiteralTriple(const std::string& s,
-                                                    const std::string& p,
-                                                    const std::string& v,
-                                                    const std::string& o) {
+void osm2rdf::ttl::Writer<T>::writeLiteralTriple(std::string_view s,
+                                                 std::string_view p,
+                                                 std::string_view v) {
   size_t part = 0;
 
 #if defined(_OPENMP)
   part = omp_get_thread_num();
-#else
-  part = 0;
 #endif
 
-  writeIRILiteralTriple(s, p, v, o, part);
+  writeLiteralTriple(s, p, v, part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeIRILiteralTriple(const std::string& s,
-                                                    const std::string& p,
-                                                    const std::string& v,
-                                                    const std::string& o,
-                                                    size_t part) {
-  _out->write(s, part);
-  _out->write(' ', part);
-  writeIRI(p, v, part);
-  _out->write(' ', part);
-  writeLiteral(o, part);
-  _out->write(" .", part);
-  _out->writeNewLine(part);
-  _lineCount[part]++;
+void osm2rdf::ttl::Writer<T>::writeLiteralTriple(std::string_view s,
+                                                 std::string_view p,
+                                                 std::string_view v,
+                                                 size_t part) {
+  writeTripleStart(s, p, part);
+  writeLiteral(v, part);
+  writeTripleEnd(part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeTriple(const std::string& s,
-                                          const std::string& p,
-                                          const std::string& o) {
+void osm2rdf::ttl::Writer<T>::writeIntegerLiteralTriple(std::string_view s,
+                                                        std::string_view p,
+                                                        int64_t v) {
   size_t part = 0;
 
 #if defined(_OPENMP)
   part = omp_get_thread_num();
 #endif
 
-  writeTriple(s, p, o, part);
+  writeIntegerLiteralTriple(s, p, v, part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeTriple(const std::string& s,
-                                          const std::string& p,
-                                          const std::string& o, size_t part) {
-  _out->write(s, part);
-  _out->write(' ', part);
-  _out->write(p, part);
-  _out->write(' ', part);
-  _out->write(o, part);
-  _out->write(" .", part);
-  _out->writeNewLine(part);
-  _lineCount[part]++;
+void osm2rdf::ttl::Writer<T>::writeIntegerLiteralTriple(std::string_view s,
+                                                        std::string_view p,
+                                                        int64_t v,
+                                                        size_t part) {
+  writeTripleStart(s, p, part);
+  writeIntegerLiteral(v, part);
+  writeTripleEnd(part);
 }
 
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeLiteralTripleUnsafe(const std::string& s,
-                                                       const std::string& p,
-                                                       const std::string& a,
-                                                       const std::string& b) {
+void osm2rdf::ttl::Writer<T>::writeLiteralTripleUnsafe(std::string_view s,
+                                                       std::string_view p,
+                                                       std::string_view a,
+                                                       std::string_view b) {
   size_t part = 0;
 
 #if defined(_OPENMP)
@@ -698,24 +1492,14 @@ void osm2rdf::ttl::Writer<T>::writeLiteralTripleUnsafe(const std::string& s,
 
 // ____________________________________________________________________________
 template <typename T>
-void osm2rdf::ttl::Writer<T>::writeLiteralTripleUnsafe(const std::string& s,
-                                                       const std::string& p,
-                                                       const std::string& a,
-                                                       const std::string& b,
+void osm2rdf::ttl::Writer<T>::writeLiteralTripleUnsafe(std::string_view s,
+                                                       std::string_view p,
+                                                       std::string_view a,
+                                                       std::string_view b,
                                                        size_t part) {
-  _out->write(s, part);
-  _out->write(' ', part);
-  _out->write(p, part);
-  _out->write(' ', part);
-
-  _out->write('"', part);
-  _out->write(a, part);
-  _out->write('"', part);
-  _out->write(b, part);
-
-  _out->write(" .", part);
-  _out->writeNewLine(part);
-  _lineCount[part]++;
+  writeTripleStart(s, p, part);
+  writeLiteralUnsafe(a, b, part);
+  writeTripleEnd(part);
 }
 
 // ____________________________________________________________________________
@@ -724,9 +1508,9 @@ std::string osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT>::formatIRI(
     std::string_view p, std::string_view v) {
   // NT:  [8]    IRIREF
   //      https://www.w3.org/TR/n-triples/#grammar-production-IRIREF
-  auto prefix = _prefixes.find(std::string{p});
-  if (prefix != _prefixes.end()) {
-    return IRIREF(prefix->second, v);
+  const auto* prefix = findPrefix(p);
+  if (prefix != nullptr) {
+    return IRIREF(prefix->iri, v);
   }
   return IRIREF(p, v);
 }
@@ -737,9 +1521,34 @@ std::string osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT>::formatIRIUnsafe(
     std::string_view p, std::string_view v) {
   // NT:  [8]    IRIREF
   //      https://www.w3.org/TR/n-triples/#grammar-production-IRIREF
-  auto prefix = _prefixes.find(std::string{p});
-  if (prefix != _prefixes.end()) {
-    return IRIREFUnsafe(prefix->second, v);
+  const auto* prefix = findPrefix(p);
+  if (prefix != nullptr) {
+    return prefix->begin + std::string{v} + prefix->end;
+  }
+  return IRIREFUnsafe(p, v);
+}
+
+// ____________________________________________________________________________
+template <>
+std::string osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::formatIRI(
+    std::string_view p, std::string_view v) {
+  // Same as NT, the formatted term is split up when written
+  const auto* prefix = findPrefix(p);
+  if (prefix != nullptr) {
+    return IRIREF(prefix->iri, v);
+  }
+  return IRIREF(p, v);
+}
+
+// ____________________________________________________________________________
+template <>
+std::string
+osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::formatIRIUnsafe(
+    std::string_view p, std::string_view v) {
+  // Same as NT, the formatted term is split up when written
+  const auto* prefix = findPrefix(p);
+  if (prefix != nullptr) {
+    return prefix->begin + std::string{v} + prefix->end;
   }
   return IRIREFUnsafe(p, v);
 }
@@ -754,10 +1563,10 @@ std::string osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL>::formatIRIUnsafe(
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   //      [136s] PrefixedName
   //      https://www.w3.org/TR/turtle/#grammar-production-PrefixedName
-  auto prefix = _prefixes.find(std::string{p});
+  const auto* prefix = findPrefix(p);
   // If known prefix -> PrefixedName
-  if (prefix != _prefixes.end()) {
-    return PrefixedNameUnsafe(p, v);
+  if (prefix != nullptr) {
+    return prefix->begin + std::string{v};
   }
   return IRIREFUnsafe(p, v);
 }
@@ -772,10 +1581,10 @@ std::string osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER>::formatIRIUnsafe(
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   //      [136s] PrefixedName
   //      https://www.w3.org/TR/turtle/#grammar-production-PrefixedName
-  auto prefix = _prefixes.find(std::string{p});
+  const auto* prefix = findPrefix(p);
   // If known prefix -> PrefixedName
-  if (prefix != _prefixes.end()) {
-    return PrefixedNameUnsafe(p, v);
+  if (prefix != nullptr) {
+    return prefix->begin + std::string{v};
   }
   return IRIREFUnsafe(p, v);
 }
@@ -790,9 +1599,8 @@ std::string osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL>::formatIRI(
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   //      [136s] PrefixedName
   //      https://www.w3.org/TR/turtle/#grammar-production-PrefixedName
-  auto prefix = _prefixes.find(std::string{p});
   // If known prefix -> PrefixedName
-  if (prefix != _prefixes.end()) {
+  if (findPrefix(p) != nullptr) {
     return PrefixedName(p, v);
   }
   return IRIREF(p, v);
@@ -808,9 +1616,8 @@ std::string osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER>::formatIRI(
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   //      [136s] PrefixedName
   //      https://www.w3.org/TR/turtle/#grammar-production-PrefixedName
-  auto prefix = _prefixes.find(std::string{p});
   // If known prefix -> PrefixedName
-  if (prefix != _prefixes.end()) {
+  if (findPrefix(p) != nullptr) {
     return PrefixedName(p, v);
   }
   return IRIREF(p, v);
@@ -868,13 +1675,9 @@ void osm2rdf::ttl::Writer<T>::writePrefixedName(std::string_view p,
 
   // check if v is well-behaved, if not, call encodePN_LOCAL, otherwise write
   // string_view directly without any additional copying
-  for (size_t pos = 0; pos < v.size(); ++pos) {
-    if (!(v[pos] == ':' || v[pos] == '_' || (v[pos] >= 'A' && v[pos] <= 'Z') ||
-          (v[pos] >= 'a' && v[pos] <= 'z') ||
-          (v[pos] >= '0' && v[pos] <= '9'))) {
-      _out->write(encodePN_LOCAL(v), part);
-      return;
-    }
+  if (osm2rdf::util::findPNLocalSpecial(v) != v.size()) {
+    _out->write(encodePN_LOCAL(v), part);
+    return;
   }
   _out->write(v, part);
 }
@@ -891,6 +1694,52 @@ void osm2rdf::ttl::Writer<T>::writePrefixedNameUnsafe(std::string_view p,
   _out->write(v, part);
 }
 
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeIRIREFUnsafe(std::string_view p,
+                                                std::string_view v,
+                                                size_t part) {
+  // NT:  [8]    IRIREF
+  //      https://www.w3.org/TR/n-triples/#grammar-production-IRIREF
+  // TTL: [18]   IRIREF (same as NT)
+  //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
+  _out->write('<', part);
+  _out->write(p, part);
+  _out->write(v, part);
+  _out->write('>', part);
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeIRIREF(
+    std::initializer_list<std::string_view> parts, size_t part) {
+  // NT:  [8]    IRIREF
+  //      https://www.w3.org/TR/n-triples/#grammar-production-IRIREF
+  // TTL: [18]   IRIREF (same as NT)
+  //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
+  _out->write('<', part);
+  for (const auto& s : parts) {
+    writeEncodedIRIREF(s, part);
+  }
+  _out->write('>', part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeIRIREF(
+    std::initializer_list<std::string_view> parts, size_t part) {
+  // Raw IRI, the reader encodes it
+  size_t length = 0;
+  for (const auto& s : parts) {
+    length += s.size();
+  }
+  writeBinaryTag(binary::Term::IRI, part);
+  writeVarint(length, part);
+  for (const auto& s : parts) {
+    _out->write(s, part);
+  }
+}
+
 // ____________________________________________________________________________
 template <typename T>
 std::string osm2rdf::ttl::Writer<T>::STRING_LITERAL_QUOTE(std::string_view s) {
@@ -901,8 +1750,10 @@ std::string osm2rdf::ttl::Writer<T>::STRING_LITERAL_QUOTE(std::string_view s) {
   std::string tmp;
   tmp.reserve(s.size() * 2);
   tmp += "\"";
-  for (const auto c : s) {
-    switch (c) {
+  size_t pos;
+  while ((pos = osm2rdf::util::findLiteralEscape(s)) != s.size()) {
+    tmp += s.substr(0, pos);
+    switch (s[pos]) {
       case '\"':  // #x22
         tmp += "\\\"";
         break;
@@ -915,10 +1766,10 @@ std::string osm2rdf::ttl::Writer<T>::STRING_LITERAL_QUOTE(std::string_view s) {
       case '\r':  // #x0D
         tmp += "\\r";
         break;
-      default:
-        tmp += c;
     }
+    s.remove_prefix(pos + 1);
   }
+  tmp += s;
   tmp += "\"";
   return tmp;
 }
@@ -1048,19 +1899,14 @@ std::string osm2rdf::ttl::Writer<T>::encodeIRIREF(std::string_view s) {
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   std::string tmp;
   tmp.reserve(s.size() * 2);
-  for (size_t pos = 0; pos < s.size(); ++pos) {
-    // Force non-allowed chars to UCHAR
-    auto c = s[pos];
-    if ((c >= 0x00 && c <= ' ') || c == '<' || c == '>' || c == '{' ||
-        c == '}' || c == '\"' || c == '|' || c == '^' || c == '`' ||
-        c == '\\') {
-      tmp += UCHAR(c);
-      continue;
-    }
-    uint8_t length = utf8Length(c);
-    tmp += s.substr(pos, length);
-    pos += length - 1;
+  // Force non-allowed chars to UCHAR, copy the runs in between in bulk
+  size_t pos;
+  while ((pos = osm2rdf::util::findIRIREFEscape(s)) != s.size()) {
+    tmp += s.substr(0, pos);
+    tmp += UCHAR(s[pos]);
+    s.remove_prefix(pos + 1);
   }
+  tmp += s;
   return tmp;
 }
 
@@ -1074,23 +1920,45 @@ std::string osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER>::encodeIRIREF(
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   std::string tmp;
   tmp.reserve(s.size() * 2);
-  for (size_t pos = 0; pos < s.size(); ++pos) {
-    uint8_t length = utf8Length(s[pos]);
-    // Force non-allowed chars to PERCENT
-    if (length == k1Byte) {
-      if ((s[pos] >= 0x00 && s[pos] <= ' ') || s[pos] == '<' || s[pos] == '>' ||
-          s[pos] == '{' || s[pos] == '}' || s[pos] == '\"' || s[pos] == '|' ||
-          s[pos] == '^' || s[pos] == '`' || s[pos] == '\\') {
-        tmp += encodePERCENT(s.substr(pos, 1));
-        continue;
-      }
-    }
-    tmp += s.substr(pos, length);
-    pos += length - 1;
+  // Force non-allowed chars to PERCENT, copy the runs in between in bulk
+  size_t pos;
+  while ((pos = osm2rdf::util::findIRIREFEscape(s)) != s.size()) {
+    tmp += s.substr(0, pos);
+    tmp += encodePERCENT(s.substr(pos, 1));
+    s.remove_prefix(pos + 1);
   }
+  tmp += s;
   return tmp;
 }
 
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::ttl::Writer<T>::writeEncodedIRIREF(std::string_view s,
+                                                 size_t part) {
+  // Same as encodeIRIREF, but writes the runs in between directly
+  size_t pos;
+  while ((pos = osm2rdf::util::findIRIREFEscape(s)) != s.size()) {
+    _out->write(s.substr(0, pos), part);
+    _out->write(UCHAR(s[pos]), part);
+    s.remove_prefix(pos + 1);
+  }
+  _out->write(s, part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER>::writeEncodedIRIREF(
+    std::string_view s, size_t part) {
+  // Same as encodeIRIREF, but writes the runs in between directly
+  size_t pos;
+  while ((pos = osm2rdf::util::findIRIREFEscape(s)) != s.size()) {
+    _out->write(s.substr(0, pos), part);
+    _out->write(encodePERCENT(s.substr(pos, 1)), part);
+    s.remove_prefix(pos + 1);
+  }
+  _out->write(s, part);
+}
+
 // ____________________________________________________________________________
 template <typename T>
 std::string osm2rdf::ttl::Writer<T>::encodePERCENT(char c) {
@@ -1201,7 +2069,9 @@ int8_t osm2rdf::ttl::Writer<T>::checkPN_LOCAL(std::string_view s) {
 
   // TTL: [168s] PN_LOCAL
   //      https://www.w3.org/TR/turtle/#grammar-production-PN_LOCAL
-  for (size_t pos = 0; pos < s.size(); ++pos) {
+  // Skip the leading chars which are always allowed (see below).
+  for (size_t pos = osm2rdf::util::findPNLocalSpecial(s); pos < s.size();
+       ++pos) {
     // PN_LOCAL      ::= (PN_CHARS_U | ':' | [0-9] | PLX)
     //                   ((PN_CHARS | '.' | ':' | PLX)*
     //                   (PN_CHARS | ':' | PLX))?
@@ -1376,12 +2246,12 @@ void osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT>::writeFormattedIRI(
     std::string_view p, std::string_view v, size_t part) {
   // NT:  [8]    IRIREF
   //      https://www.w3.org/TR/n-triples/#grammar-production-IRIREF
-  auto prefix = _prefixes.find(std::string{p});
-  if (prefix != _prefixes.end()) {
-    _out->write(IRIREF(prefix->second, v), part);
+  const auto* prefix = findPrefix(p);
+  if (prefix != nullptr) {
+    writeIRIREF({prefix->iri, v}, part);
     return;
   }
-  _out->write(IRIREF(p, v), part);
+  writeIRIREF({p, v}, part);
 }
 
 // ____________________________________________________________________________
@@ -1390,12 +2260,12 @@ void osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT>::writeFormattedIRIUnsafe(
     std::string_view p, std::string_view v, size_t part) {
   // NT:  [8]    IRIREF
   //      https://www.w3.org/TR/n-triples/#grammar-production-IRIREF
-  auto prefix = _prefixes.find(std::string{p});
-  if (prefix != _prefixes.end()) {
-    _out->write(IRIREFUnsafe(prefix->second, v), part);
+  auto prefixId = _prefixIds.find(p);
+  if (prefixId != _prefixIds.end()) {
+    writeIRIUnsafe(prefixId->second, v, part);
     return;
   }
-  _out->write(IRIREFUnsafe(p, v), part);
+  writeIRIREFUnsafe(p, v, part);
 }
 
 // ____________________________________________________________________________
@@ -1408,13 +2278,13 @@ void osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL>::writeFormattedIRIUnsafe(
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   //      [136s] PrefixedName
   //      https://www.w3.org/TR/turtle/#grammar-production-PrefixedName
-  auto prefix = _prefixes.find(std::string{p});
+  auto prefixId = _prefixIds.find(p);
   // If known prefix -> PrefixedName
-  if (prefix != _prefixes.end()) {
-    writePrefixedNameUnsafe(p, v, part);
+  if (prefixId != _prefixIds.end()) {
+    writeIRIUnsafe(prefixId->second, v, part);
     return;
   }
-  _out->write(IRIREFUnsafe(p, v), part);
+  writeIRIREFUnsafe(p, v, part);
 }
 
 // ____________________________________________________________________________
@@ -1429,13 +2299,13 @@ void osm2rdf::ttl::Writer<
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   //      [136s] PrefixedName
   //      https://www.w3.org/TR/turtle/#grammar-production-PrefixedName
-  auto prefix = _prefixes.find(std::string{p});
+  auto prefixId = _prefixIds.find(p);
   // If known prefix -> PrefixedName
-  if (prefix != _prefixes.end()) {
-    writePrefixedNameUnsafe(p, v, part);
+  if (prefixId != _prefixIds.end()) {
+    writeIRIUnsafe(prefixId->second, v, part);
     return;
   }
-  _out->write(IRIREFUnsafe(p, v), part);
+  writeIRIREFUnsafe(p, v, part);
 }
 
 // ____________________________________________________________________________
@@ -1448,13 +2318,12 @@ void osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL>::writeFormattedIRI(
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   //      [136s] PrefixedName
   //      https://www.w3.org/TR/turtle/#grammar-production-PrefixedName
-  auto prefix = _prefixes.find(std::string{p});
   // If known prefix -> PrefixedName
-  if (prefix != _prefixes.end()) {
+  if (findPrefix(p) != nullptr) {
     writePrefixedName(p, v, part);
     return;
   }
-  _out->write(IRIREF(p, v), part);
+  writeIRIREF({p, v}, part);
 }
 
 // ____________________________________________________________________________
@@ -1467,13 +2336,34 @@ void osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER>::writeFormattedIRI(
   //      https://www.w3.org/TR/turtle/#grammar-production-IRIREF
   //      [136s] PrefixedName
   //      https://www.w3.org/TR/turtle/#grammar-production-PrefixedName
-  auto prefix = _prefixes.find(std::string{p});
   // If known prefix -> PrefixedName
-  if (prefix != _prefixes.end()) {
+  if (findPrefix(p) != nullptr) {
     writePrefixedName(p, v, part);
     return;
   }
-  _out->write(IRIREF(p, v), part);
+  writeIRIREF({p, v}, part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::writeFormattedIRI(
+    std::string_view p, std::string_view v, size_t part) {
+  // Raw local part or IRI, the reader encodes it
+  auto prefixId = _prefixIds.find(p);
+  if (prefixId != _prefixIds.end()) {
+    writeIRIUnsafe(prefixId->second, v, part);
+    return;
+  }
+  writeIRIREF({p, v}, part);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<
+    osm2rdf::ttl::format::BINARY>::writeFormattedIRIUnsafe(std::string_view p,
+                                                           std::string_view v,
+                                                           size_t part) {
+  writeFormattedIRI(p, v, part);
 }
 
 // ____________________________________________________________________________
@@ -1487,51 +2377,14 @@ void osm2rdf::ttl::Writer<T>::writeSecondsAsISO(const std::string& subj,
   part = omp_get_thread_num();
 #endif
 
-  _out->write(subj, part);
-  _out->write(' ', part);
-  _out->write(pred, part);
-  _out->write(' ', part);
-
-  _out->write('"', part);
-
-  struct tm t;
-  gmtime_r(&time, &t);
-
-  int year = t.tm_year + 1900;
-  int month = t.tm_mon + 1;
-
-  // 4 digit year
-  _out->write('0' + (year / 1000) % 10, part);
-  _out->write('0' + (year / 100) % 10, part);
-  _out->write('0' + (year / 10) % 10, part);
-  _out->write('0' + (year % 10), part);
-  _out->write('-', part);
-
-  _out->write('0' + (month / 10) % 10, part);
-  _out->write('0' + (month % 10), part);
-  _out->write('-', part);
-
-  _out->write('0' + (t.tm_mday / 10) % 10, part);
-  _out->write('0' + (t.tm_mday % 10), part);
-  _out->write('T', part);
+  char buf[osm2rdf::util::ISO_TIME_LENGTH];
+  _timeFormatters[part].format(time, buf);
 
-  _out->write('0' + (t.tm_hour / 10) % 10, part);
-  _out->write('0' + (t.tm_hour % 10), part);
-  _out->write(':', part);
-
-  _out->write('0' + (t.tm_min / 10) % 10, part);
-  _out->write('0' + (t.tm_min % 10), part);
-  _out->write(':', part);
-
-  _out->write('0' + (t.tm_sec / 10) % 10, part);
-  _out->write('0' + (t.tm_sec % 10), part);
-
-  _out->write("\"^^", part);
-  _out->write(constants::IRI__XSD__DATE_TIME, part);
-
-  _out->write(" .", part);
-  _out->writeNewLine(part);
-  _lineCount[part]++;
+  writeTripleStart(subj, pred, part);
+  writeLiteralStart(part);
+  write(std::string_view(buf, osm2rdf::util::ISO_TIME_LENGTH), part);
+  writeLiteralEnd(_xsdPrefix, "dateTime", part);
+  writeTripleEnd(part);
 }
 
 // ____________________________________________________________________________
@@ -1572,6 +2425,27 @@ void osm2rdf::ttl::Writer<T>::write(const char* s, size_t part) {
   _out->write(s, part);
 }
 
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::write(const char c,
+                                                               size_t part) {
+  _rawObjects[part].push_back(c);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::write(
+    std::string_view s, size_t part) {
+  _rawObjects[part].append(s);
+}
+
+// ____________________________________________________________________________
+template <>
+void osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>::write(const char* s,
+                                                               size_t part) {
+  _rawObjects[part].append(s);
+}
+
 // ____________________________________________________________________________
 template <typename T>
 void osm2rdf::ttl::Writer<T>::write(const char c) {
@@ -1581,7 +2455,7 @@ void osm2rdf::ttl::Writer<T>::write(const char c) {
   part = omp_get_thread_num();
 #endif
 
-  _out->write(c, part);
+  write(c, part);
 }
 
 // ____________________________________________________________________________
@@ -1593,7 +2467,7 @@ void osm2rdf::ttl::Writer<T>::write(std::string_view s) {
   part = omp_get_thread_num();
 #endif
 
-  _out->write(s, part);
+  write(s, part);
 }
 
 // ____________________________________________________________________________
@@ -1605,10 +2479,11 @@ void osm2rdf::ttl::Writer<T>::write(const char* s) {
   part = omp_get_thread_num();
 #endif
 
-  _out->write(s, part);
+  write(s, part);
 }
 
 // ____________________________________________________________________________
 template class osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT>;
 template class osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL>;
 template class osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER>;
+template class osm2rdf::ttl::Writer<osm2rdf::ttl::format::BINARY>;
@@ -0,0 +1,524 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "osm2rdf/util/AuxGeoCache.h"
+
+#include <fcntl.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "osm2rdf/config/Constants.h"
+#include "util/geo/Geo.h"
+
+using osm2rdf::util::AuxGeoCache;
+using osm2rdf::util::AuxGeoType;
+
+namespace {
+
+// Minimal WKT reader for a single, null-terminated line.
+class WKTReader {
+ public:
+  WKTReader(
+      const char* c,
+      const std::function<::util::geo::I32Point(const ::util::geo::DPoint&)>&
+          project)
+      : _c(c), _project(project) {}
+
+  bool keyword(const char* kw) {
+    skipWS();
+    size_t n = strlen(kw);
+    if (strncasecmp(_c, kw, n) != 0) return false;
+    _c += n;
+    return true;
+  }
+
+  void expect(char c) {
+    skipWS();
+    if (*_c != c) {
+      throw std::runtime_error(std::string("Expected '") + c + "' in WKT");
+    }
+    _c++;
+  }
+
+  // Only whitespace may follow a complete geometry.
+  void end() {
+    skipWS();
+    if (*_c != 0) {
+      throw std::runtime_error("Unexpected characters after WKT geometry");
+    }
+  }
+
+  bool accept(char c) {
+    skipWS();
+    if (*_c != c) return false;
+    _c++;
+    return true;
+  }
+
+  ::util::geo::I32Point point() {
+    char* end;
+    double x = strtod(_c, &end);
+    if (end == _c) throw std::runtime_error("Expected coordinate in WKT");
+    _c = end;
+    double y = strtod(_c, &end);
+    if (end == _c) throw std::runtime_error("Expected coordinate in WKT");
+    _c = end;
+    return _project(::util::geo::DPoint{x, y});
+  }
+
+  ::util::geo::I32Line line() {
+    ::util::geo::I32Line l;
+    expect('(');
+    do {
+      l.push_back(point());
+    } while (accept(','));
+    expect(')');
+    return l;
+  }
+
+  ::util::geo::Polygon<int32_t> polygon() {
+    ::util::geo::Polygon<int32_t> p;
+    expect('(');
+    p.getOuter() = line();
+    while (accept(',')) {
+      p.getInners().push_back(line());
+    }
+    expect(')');
+    return p;
+  }
+
+ private:
+  void skipWS() {
+    while (*_c == ' ' || *_c == '\t' || *_c == '\r') _c++;
+  }
+
+  const char* _c;
+  const std::function<::util::geo::I32Point(const ::util::geo::DPoint&)>&
+      _project;
+};
+
+}  // namespace
+
+// ____________________________________________________________________________
+AuxGeoCache::AuxGeoCache(const std::filesystem::path& path) {
+  _fd = ::open(path.c_str(), O_RDONLY);
+  if (_fd < 0) {
+    throw std::runtime_error("Could not open auxiliary geo cache " +
+                             path.string() + ": " + strerror(errno));
+  }
+
+  struct stat st;
+  if (fstat(_fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) < MAGIC.size() + 2 * sizeof(uint64_t)) {
+    ::close(_fd);
+    throw std::runtime_error("Invalid auxiliary geo cache " + path.string());
+  }
+  _dataSize = st.st_size;
+
+  void* data = mmap(nullptr, _dataSize, PROT_READ, MAP_SHARED, _fd, 0);
+  if (data == MAP_FAILED) {
+    ::close(_fd);
+    throw std::runtime_error("Could not map auxiliary geo cache " +
+                             path.string() + ": " + strerror(errno));
+  }
+  _data = static_cast<char*>(data);
+  madvise(_data, _dataSize, MADV_WILLNEED);
+
+  if (memcmp(_data, MAGIC.data(), MAGIC.size()) != 0) {
+    munmap(_data, _dataSize);
+    ::close(_fd);
+    throw std::runtime_error("Invalid auxiliary geo cache " + path.string());
+  }
+
+  uint64_t tableOffset;
+  memcpy(&_size, _data + MAGIC.size(), sizeof(uint64_t));
+  memcpy(&tableOffset, _data + MAGIC.size() + sizeof(uint64_t),
+         sizeof(uint64_t));
+
+  if (tableOffset + _size * sizeof(uint64_t) > _dataSize) {
+    munmap(_data, _dataSize);
+    ::close(_fd);
+    throw std::runtime_error("Truncated auxiliary geo cache " + path.string());
+  }
+  _offsets = _data + tableOffset;
+
+  for (size_t i = 0; i < _size; i++) {
+    if (!validRecord(i, _offsets)) {
+      munmap(_data, _dataSize);
+      ::close(_fd);
+      throw std::runtime_error("Corrupt auxiliary geo cache " + path.string());
+    }
+  }
+}
+
+// ____________________________________________________________________________
+bool AuxGeoCache::validRecord(size_t i, const char* end) const {
+  uint64_t offset;
+  memcpy(&offset, _offsets + i * sizeof(uint64_t), sizeof(uint64_t));
+  const uint64_t headerSize = MAGIC.size() + 2 * sizeof(uint64_t);
+  if (offset < headerSize || offset > static_cast<uint64_t>(end - _data)) {
+    return false;
+  }
+
+  const char* c = _data + offset;
+  const auto skip = [&](uint64_t n) {
+    if (static_cast<uint64_t>(end - c) < n) return false;
+    c += n;
+    return true;
+  };
+  const auto read = [&](uint32_t* v) {
+    if (!skip(sizeof(uint32_t))) return false;
+    memcpy(v, c - sizeof(uint32_t), sizeof(uint32_t));
+    return true;
+  };
+  const auto skipLine = [&]() {
+    uint32_t n;
+    return read(&n) && skip(uint64_t{n} * 2 * sizeof(int32_t));
+  };
+
+  uint8_t type;
+  uint32_t n;
+  if (!skip(1)) return false;
+  memcpy(&type, c - 1, 1);
+  if (!read(&n) || !skip(n)) return false;
+
+  switch (static_cast<AuxGeoType>(type)) {
+    case AuxGeoType::POINT:
+      return skip(2 * sizeof(int32_t));
+    case AuxGeoType::LINE:
+      return skipLine();
+    case AuxGeoType::MULTIPOLYGON: {
+      uint32_t numPolys;
+      if (!read(&numPolys)) return false;
+      for (uint32_t j = 0; j < numPolys; j++) {
+        uint32_t numRings;
+        if (!read(&numRings)) return false;
+        for (uint32_t k = 0; k < numRings; k++) {
+          if (!skipLine()) return false;
+        }
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+// ____________________________________________________________________________
+AuxGeoCache::~AuxGeoCache() {
+  if (_data != nullptr) munmap(_data, _dataSize);
+  if (_fd >= 0) ::close(_fd);
+}
+
+// ____________________________________________________________________________
+size_t AuxGeoCache::size() const { return _size; }
+
+// ____________________________________________________________________________
+const char* AuxGeoCache::record(size_t i) const {
+  uint64_t offset;
+  memcpy(&offset, _offsets + i * sizeof(uint64_t), sizeof(uint64_t));
+  return _data + offset;
+}
+
+// ____________________________________________________________________________
+AuxGeoType AuxGeoCache::type(size_t i) const {
+  return static_cast<AuxGeoType>(*record(i));
+}
+
+// ____________________________________________________________________________
+std::string_view AuxGeoCache::id(size_t i) const {
+  const char* c = record(i) + 1;
+  uint32_t len;
+  memcpy(&len, c, sizeof(uint32_t));
+  return {c + sizeof(uint32_t), len};
+}
+
+// ____________________________________________________________________________
+const char* AuxGeoCache::idEnd(size_t i) const {
+  auto ret = id(i);
+  return ret.data() + ret.size();
+}
+
+// ____________________________________________________________________________
+::util::geo::I32Point AuxGeoCache::point(size_t i) const {
+  const char* c = idEnd(i);
+  int32_t xy[2];
+  memcpy(xy, c, sizeof(xy));
+  return {xy[0], xy[1]};
+}
+
+// ____________________________________________________________________________
+const char* AuxGeoCache::readLine(const char* c, ::util::geo::I32Line* line) {
+  uint32_t n;
+  memcpy(&n, c, sizeof(uint32_t));
+  c += sizeof(uint32_t);
+  line->reserve(n);
+  for (uint32_t j = 0; j < n; j++) {
+    int32_t xy[2];
+    memcpy(xy, c, sizeof(xy));
+    c += sizeof(xy);
+    line->push_back({xy[0], xy[1]});
+  }
+  return c;
+}
+
+// ____________________________________________________________________________
+::util::geo::I32Line AuxGeoCache::line(size_t i) const {
+  ::util::geo::I32Line l;
+  readLine(idEnd(i), &l);
+  return l;
+}
+
+// ____________________________________________________________________________
+::util::geo::I32MultiPolygon AuxGeoCache::multiPolygon(size_t i) const {
+  const char* c = idEnd(i);
+  uint32_t numPolys;
+  memcpy(&numPolys, c, sizeof(uint32_t));
+  c += sizeof(uint32_t);
+
+  ::util::geo::I32MultiPolygon mp(numPolys);
+  for (auto& poly : mp) {
+    uint32_t numRings;
+    memcpy(&numRings, c, sizeof(uint32_t));
+    c += sizeof(uint32_t);
+    if (numRings == 0) continue;
+    c = readLine(c, &poly.getOuter());
+    poly.getInners().resize(numRings - 1);
+    for (auto& inner : poly.getInners()) {
+      c = readLine(c, &inner);
+    }
+  }
+  return mp;
+}
+
+// ____________________________________________________________________________
+bool AuxGeoCache::isCacheFile(const std::filesystem::path& path) {
+  std::ifstream in{path, std::ifstream::binary};
+  std::string magic(MAGIC.size(), 0);
+  in.read(magic.data(), magic.size());
+  return in.good() && magic == MAGIC;
+}
+
+// ____________________________________________________________________________
+std::filesystem::path AuxGeoCache::cachePath(
+    const std::filesystem::path& cacheDir,
+    const std::filesystem::path& wktPath) {
+  const auto abs = std::filesystem::absolute(wktPath).lexically_normal();
+  std::stringstream ss;
+  ss << wktPath.filename().string() << "-" << std::hex
+     << std::hash<std::string>{}(abs.string())
+     << osm2rdf::config::constants::AUX_GEO_CACHE_EXTENSION;
+  return cacheDir / ss.str();
+}
+
+// ____________________________________________________________________________
+size_t AuxGeoCache::convert(
+    const std::filesystem::path& wktPath,
+    const std::filesystem::path& cachePath,
+    const std::function<::util::geo::I32Point(const ::util::geo::DPoint&)>&
+        project) {
+  std::ifstream in{wktPath};
+  if (!in.is_open()) {
+    throw std::runtime_error("Could not read auxiliary geo file " +
+                             wktPath.string());
+  }
+
+  Writer writer{cachePath};
+  std::string line;
+  size_t lineNumber = 0;
+  size_t count = 0;
+  while (std::getline(in, line)) {
+    lineNumber++;
+    if (line.empty()) continue;
+
+    // ids are required, as implicit line number ids are not unique when
+    // the WKT files are parsed in chunks
+    size_t tab = line.find('\t');
+    if (tab == std::string::npos) {
+      std::stringstream ss;
+      ss << wktPath.string() << ":" << lineNumber
+         << ": Missing id, expected <id>\\t<WKT>";
+      throw std::runtime_error(ss.str());
+    }
+    const std::string id = line.substr(0, tab);
+    const char* wkt = line.c_str() + tab + 1;
+
+    try {
+      WKTReader r{wkt, project};
+      if (r.keyword("MULTIPOLYGON")) {
+        if (r.keyword("EMPTY")) continue;
+        ::util::geo::I32MultiPolygon mp;
+        r.expect('(');
+        do {
+          mp.push_back(r.polygon());
+        } while (r.accept(','));
+        r.expect(')');
+        r.end();
+        writer.add(id, mp);
+      } else if (r.keyword("POLYGON")) {
+        if (r.keyword("EMPTY")) continue;
+        ::util::geo::I32MultiPolygon mp{r.polygon()};
+        r.end();
+        writer.add(id, mp);
+      } else if (r.keyword("LINESTRING")) {
+        if (r.keyword("EMPTY")) continue;
+        auto l = r.line();
+        r.end();
+        writer.add(id, l);
+      } else if (r.keyword("POINT")) {
+        if (r.keyword("EMPTY")) continue;
+        r.expect('(');
+        auto p = r.point();
+        r.expect(')');
+        r.end();
+        writer.add(id, p);
+      } else {
+        throw std::runtime_error("Unsupported geometry type");
+      }
+    } catch (const std::runtime_error& e) {
+      std::stringstream ss;
+      ss << wktPath.string() << ":" << lineNumber << ": " << e.what();
+      throw std::runtime_error(ss.str());
+    }
+    count++;
+  }
+
+  writer.close();
+  return count;
+}
+
+// ____________________________________________________________________________
+AuxGeoCache::Writer::Writer(const std::filesystem::path& path)
+    : _path(path),
+      _tmpPath(path.string() + ".tmp-" + std::to_string(getpid())),
+      _out(_tmpPath, std::ofstream::binary | std::ofstream::trunc) {
+  if (!_out.is_open()) {
+    throw std::runtime_error("Could not open auxiliary geo cache " +
+                             _tmpPath.string() + " for writing");
+  }
+  // Header is written on close, an incomplete file is never a valid cache.
+  _out.write(std::string(MAGIC.size(), 0).data(), MAGIC.size());
+  writeValue<uint64_t>(0);
+  writeValue<uint64_t>(0);
+  _pos = MAGIC.size() + 2 * sizeof(uint64_t);
+}
+
+// ____________________________________________________________________________
+AuxGeoCache::Writer::~Writer() {
+  // Not closed, the cache is incomplete
+  if (_out.is_open()) {
+    _out.close();
+    std::error_code ec;
+    std::filesystem::remove(_tmpPath, ec);
+  }
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void AuxGeoCache::Writer::writeValue(T value) {
+  _out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  _pos += sizeof(T);
+}
+
+// ____________________________________________________________________________
+void AuxGeoCache::Writer::writeHeader(std::string_view id, AuxGeoType type) {
+  _offsets.push_back(_pos);
+  writeValue(static_cast<uint8_t>(type));
+  writeValue(static_cast<uint32_t>(id.size()));
+  _out.write(id.data(), id.size());
+  _pos += id.size();
+}
+
+// ____________________________________________________________________________
+void AuxGeoCache::Writer::writeLine(const ::util::geo::I32Line& line) {
+  writeValue(static_cast<uint32_t>(line.size()));
+  for (const auto& p : line) {
+    writeValue<int32_t>(p.getX());
+    writeValue<int32_t>(p.getY());
+  }
+}
+
+// ____________________________________________________________________________
+void AuxGeoCache::Writer::add(std::string_view id,
+                              const ::util::geo::I32Point& point) {
+  writeHeader(id, AuxGeoType::POINT);
+  writeValue<int32_t>(point.getX());
+  writeValue<int32_t>(point.getY());
+}
+
+// ____________________________________________________________________________
+void AuxGeoCache::Writer::add(std::string_view id,
+                              const ::util::geo::I32Line& line) {
+  writeHeader(id, AuxGeoType::LINE);
+  writeLine(line);
+}
+
+// ____________________________________________________________________________
+void AuxGeoCache::Writer::add(std::string_view id,
+                              const ::util::geo::I32MultiPolygon& mp) {
+  writeHeader(id, AuxGeoType::MULTIPOLYGON);
+  writeValue(static_cast<uint32_t>(mp.size()));
+  for (const auto& poly : mp) {
+    writeValue(static_cast<uint32_t>(poly.getInners().size() + 1));
+    writeLine(poly.getOuter());
+    for (const auto& inner : poly.getInners()) {
+      writeLine(inner);
+    }
+  }
+}
+
+// ____________________________________________________________________________
+void AuxGeoCache::Writer::close() {
+  if (!_out.is_open()) return;
+
+  const uint64_t tableOffset = _pos;
+  for (uint64_t offset : _offsets) {
+    writeValue(offset);
+  }
+
+  _out.seekp(0);
+  _out.write(MAGIC.data(), MAGIC.size());
+  writeValue(static_cast<uint64_t>(_offsets.size()));
+  writeValue(tableOffset);
+  _out.close();
+
+  std::error_code ec;
+  if (_out.fail()) {
+    std::filesystem::remove(_tmpPath, ec);
+    throw std::runtime_error("Could not write auxiliary geo cache " +
+                             _path.string());
+  }
+
+  // Atomically replace, concurrent readers see the old or the new cache
+  std::filesystem::rename(_tmpPath, _path, ec);
+  if (ec) {
+    std::filesystem::remove(_tmpPath, ec);
+    throw std::runtime_error("Could not write auxiliary geo cache " +
+                             _path.string());
+  }
+}
@@ -0,0 +1,80 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "osm2rdf/util/Date.h"
+
+// Cap for month and day values while parsing, anything above is invalid.
+static const uint32_t MAX_COMPONENT = 100;
+
+// ____________________________________________________________________________
+osm2rdf::util::DateType osm2rdf::util::normalizeDate(std::string_view v,
+                                                     char* buf, size_t* len) {
+  size_t pos = 0;
+  size_t out = 0;
+  bool hasDigit = false;
+  if (!v.empty() && v[0] == '-') {
+    buf[out++] = '-';
+    pos = 1;
+  }
+
+  uint8_t component = 0;
+  while (true) {
+    if (component == 3) return DateType::INVALID;
+    if (component > 0) buf[out++] = '-';
+
+    if (component == 0) {
+      // Keep up to 4 significant digits of the year, skipping leading zeros.
+      char digits[4];
+      size_t numDigits = 0;
+      for (; pos < v.size() && v[pos] != '-'; pos++) {
+        const char c = v[pos];
+        if (c < '0' || c > '9') return DateType::INVALID;
+        hasDigit = true;
+        if (numDigits == 0 && c == '0') continue;
+        if (numDigits < 4) digits[numDigits] = c;
+        numDigits++;
+      }
+      if (numDigits > 4) numDigits = 4;
+      for (size_t i = numDigits; i < 4; i++) buf[out++] = '0';
+      for (size_t i = 0; i < numDigits; i++) buf[out++] = digits[i];
+    } else {
+      uint32_t val = 0;
+      for (; pos < v.size() && v[pos] != '-'; pos++) {
+        const char c = v[pos];
+        if (c < '0' || c > '9') return DateType::INVALID;
+        hasDigit = true;
+        val = val * 10 + (c - '0');
+        if (val > MAX_COMPONENT) val = MAX_COMPONENT;
+      }
+      if (val < 1 || val > (component == 1 ? 12 : 31)) {
+        return DateType::INVALID;
+      }
+      buf[out++] = static_cast<char>('0' + val / 10);
+      buf[out++] = static_cast<char>('0' + val % 10);
+    }
+    component++;
+
+    if (pos == v.size()) break;
+    pos++;  // skip '-'
+  }
+
+  if (!hasDigit) return DateType::INVALID;
+  *len = out;
+  return static_cast<DateType>(component);
+}
@@ -19,54 +19,150 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <cassert>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
-#include <set>
-#include <queue>
+#include <limits>
+#include <stdexcept>
 
 #include "osm2rdf/util/DirectedGraph.h"
 
 // ____________________________________________________________________________
 template <typename T>
 void osm2rdf::util::DirectedGraph<T>::addEdge(T src, T dst) {
-  _adjacency[src].push_back(dst);
-  if (_adjacency.find(dst) == _adjacency.end()) {
-    _adjacency[dst] = {};
+  if (_frozen) {
+    thaw();
   }
+  _edges.emplace_back(src, dst);
   _numEdges++;
+  _preparedFast = false;
 }
 
 // ____________________________________________________________________________
 template <typename T>
-std::vector<T> osm2rdf::util::DirectedGraph<T>::findSuccessors(T src) const {
-  std::queue<T> q;
-  std::set<T> visited;
-  q.push(src);
-
-  while (!q.empty()) {
-    auto cur = q.front();
-    visited.insert(cur);
-    q.pop();
-
-    const auto& entry = _adjacency.find(cur);
-    if (entry == _adjacency.end()) {
-      continue;
+void osm2rdf::util::DirectedGraph<T>::thaw() {
+  _edges.clear();
+  _edges.reserve(_targets.size());
+  for (size_t i = 0; i + 1 < _offsets.size(); i++) {
+    for (size_t j = _offsets[i]; j < _offsets[i + 1]; j++) {
+      _edges.emplace_back(_vertices[i], _vertices[_targets[j]]);
     }
+  }
+  _vertices = {};
+  _offsets = {0};
+  _targets = {};
+  _frozen = false;
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::util::DirectedGraph<T>::freeze() {
+  if (_frozen) {
+    return;
+  }
+
+  _vertices.clear();
+  _vertices.reserve(_edges.size() * 2);
+  for (const auto& [src, dst] : _edges) {
+    _vertices.push_back(src);
+    _vertices.push_back(dst);
+  }
+  std::sort(_vertices.begin(), _vertices.end());
+  _vertices.erase(std::unique(_vertices.begin(), _vertices.end()),
+                  _vertices.end());
+  _vertices.shrink_to_fit();
+
+  if (_vertices.size() > std::numeric_limits<index_t>::max()) {
+    throw std::length_error("Too many vertices in graph");
+  }
+
+  // count edges per vertex, then place them in insertion order
+  _offsets.assign(_vertices.size() + 1, 0);
+  std::vector<index_t> srcIdx(_edges.size());
+  for (size_t i = 0; i < _edges.size(); i++) {
+    findIndex(_edges[i].first, &srcIdx[i]);
+    _offsets[srcIdx[i] + 1]++;
+  }
+  for (size_t i = 1; i < _offsets.size(); i++) {
+    _offsets[i] += _offsets[i - 1];
+  }
+
+  std::vector<size_t> fill(_offsets.begin(), _offsets.end() - 1);
+  _targets.resize(_edges.size());
+  for (size_t i = 0; i < _edges.size(); i++) {
+    index_t dst;
+    findIndex(_edges[i].second, &dst);
+    _targets[fill[srcIdx[i]]++] = dst;
+  }
+
+  _edges = {};
+  _frozen = true;
+}
+
+// ____________________________________________________________________________
+template <typename T>
+bool osm2rdf::util::DirectedGraph<T>::findIndex(T id, index_t* i) const {
+  const auto it = std::lower_bound(_vertices.begin(), _vertices.end(), id);
+  if (it == _vertices.end() || *it != id) {
+    return false;
+  }
+  *i = static_cast<index_t>(it - _vertices.begin());
+  return true;
+}
+
+// ____________________________________________________________________________
+template <typename T>
+void osm2rdf::util::DirectedGraph<T>::findSuccessorsHelper(
+    index_t src, std::vector<index_t>* res) const {
+  // visited vertices, only the touched words are reset afterwards
+  thread_local std::vector<uint64_t> visited;
+  if (visited.size() < (_vertices.size() + 63) / 64) {
+    visited.resize((_vertices.size() + 63) / 64);
+  }
+
+  const size_t start = res->size();
+  std::vector<index_t> stack{src};
+  visited[src / 64] |= 1ULL << (src % 64);
 
-    for (const auto& nd : entry->second) {
-      if (visited.find(nd) == visited.end()) q.push(nd);
+  while (!stack.empty()) {
+    const auto cur = stack.back();
+    stack.pop_back();
+    for (auto it = edgesBegin(cur); it != edgesEnd(cur); it++) {
+      if (visited[*it / 64] & (1ULL << (*it % 64))) continue;
+      visited[*it / 64] |= 1ULL << (*it % 64);
+      stack.push_back(*it);
+      res->push_back(*it);
     }
   }
 
-  visited.erase(src);
+  visited[src / 64] = 0;
+  for (size_t i = start; i < res->size(); i++) {
+    visited[(*res)[i] / 64] = 0;
+  }
+
+  std::sort(res->begin() + start, res->end());
+}
+
+// ____________________________________________________________________________
+template <typename T>
+std::vector<T> osm2rdf::util::DirectedGraph<T>::findSuccessors(T src) const {
+  assert(_frozen);
+  index_t i;
+  if (!findIndex(src, &i)) {
+    return {};
+  }
 
-  std::vector<T> tmp;
-  tmp.reserve(visited.size());
-  tmp.insert(tmp.end(), visited.begin(), visited.end());
+  std::vector<index_t> tmp;
+  findSuccessorsHelper(i, &tmp);
 
-  // guaranteed to be sorted
-  return tmp;
+  // indices are sorted, and so are the ids
+  std::vector<T> res;
+  res.reserve(tmp.size());
+  for (const auto& j : tmp) {
+    res.push_back(_vertices[j]);
+  }
+  return res;
 }
 
 // ____________________________________________________________________________
@@ -76,25 +172,33 @@ std::vector<T> osm2rdf::util::DirectedGraph<T>::findSuccessorsFast(
   if (!_preparedFast) {
     throw std::runtime_error("findSuccessorsFast not prepared");
   }
-  const auto& entry = _successors.find(src);
-  if (entry == _successors.end()) {
-    return std::vector<T>();
+  index_t i;
+  if (!findIndex(src, &i)) {
+    return {};
   }
-  return entry->second;
+  std::vector<T> res;
+  res.reserve(_successorOffsets[i + 1] - _successorOffsets[i]);
+  for (size_t j = _successorOffsets[i]; j < _successorOffsets[i + 1]; j++) {
+    res.push_back(_vertices[_successors[j]]);
+  }
+  return res;
 }
 
 // ____________________________________________________________________________
 template <typename T>
 void osm2rdf::util::DirectedGraph<T>::dump(
     const std::filesystem::path& filename) const {
+  assert(_frozen);
   std::ofstream ofs(filename, std::ofstream::out);
 
   ofs << "digraph osm2rdf {\nrankdir=\"BT\"\n";
-  for (const auto& [src, list] : _adjacency) {
+  for (index_t i = 0; i < _vertices.size(); i++) {
+    const auto src = _vertices[i];
     ofs << std::to_string(src) << " [label=\"" << std::to_string(src)
         << "\", shape=rectangle, style=solid]\n";
-    for (const auto& dst : list) {
-      ofs << std::to_string(src) << " -> " << std::to_string(dst) << "\n";
+    for (auto it = edgesBegin(i); it != edgesEnd(i); it++) {
+      ofs << std::to_string(src) << " -> " << std::to_string(_vertices[*it])
+          << "\n";
     }
   }
   ofs << "}\n";
@@ -106,11 +210,12 @@ void osm2rdf::util::DirectedGraph<T>::dump(
 template <typename T>
 void osm2rdf::util::DirectedGraph<T>::dumpOsm(
     const std::filesystem::path& filename) const {
+  assert(_frozen);
   std::ofstream ofs(filename, std::ofstream::out);
 
   ofs << "digraph osm2rdf {\nrankdir=\"BT\"\n";
-  for (const auto& [id, list] : _adjacency) {
-    uint64_t src = id;
+  for (index_t i = 0; i < _vertices.size(); i++) {
+    uint64_t src = _vertices[i];
     std::string shape = "rectangle";
     if ((src & 1U) == 1) {
       shape = "ellipse";
@@ -119,8 +224,8 @@ void osm2rdf::util::DirectedGraph<T>::dumpOsm(
     src /= 2;
     ofs << std::to_string(src) << " [label=\"" << std::to_string(src)
         << "\", shape=" << shape << ", style=solid]\n";
-    for (const auto& dstId : list) {
-      uint64_t dst = dstId;
+    for (auto it = edgesBegin(i); it != edgesEnd(i); it++) {
+      uint64_t dst = _vertices[*it];
       if ((dst & 1U) == 1) {
         dst -= 1;
       }
@@ -136,8 +241,66 @@ void osm2rdf::util::DirectedGraph<T>::dumpOsm(
 // ____________________________________________________________________________
 template <typename T>
 void osm2rdf::util::DirectedGraph<T>::prepareFindSuccessorsFast() {
-  for (const auto& [key, _] : _adjacency) {
-    _successors[key] = findSuccessors(key);
+  freeze();
+  const size_t n = _vertices.size();
+
+  // topological order (Kahn), successors of a vertex are always placed
+  // before the vertex itself
+  std::vector<size_t> inDegree(n, 0);
+  for (const auto& t : _targets) {
+    inDegree[t]++;
+  }
+  std::vector<index_t> order;
+  order.reserve(n);
+  for (index_t i = 0; i < n; i++) {
+    if (inDegree[i] == 0) order.push_back(i);
+  }
+  for (size_t k = 0; k < order.size(); k++) {
+    for (auto it = edgesBegin(order[k]); it != edgesEnd(order[k]); it++) {
+      if (--inDegree[*it] == 0) order.push_back(*it);
+    }
+  }
+
+  std::vector<std::vector<index_t>> successors(n);
+  if (order.size() < n) {
+    // cyclic, fall back to a search from each vertex
+    for (index_t i = 0; i < n; i++) {
+      findSuccessorsHelper(i, &successors[i]);
+    }
+  } else {
+    // in reverse topological order, the successors of a vertex are the union
+    // of its direct successors and their already computed successors
+    std::vector<uint64_t> visited((n + 63) / 64, 0);
+    for (size_t k = order.size(); k-- > 0;) {
+      const auto i = order[k];
+      auto& res = successors[i];
+      const auto mark = [&](index_t j) {
+        if (visited[j / 64] & (1ULL << (j % 64))) return;
+        visited[j / 64] |= 1ULL << (j % 64);
+        res.push_back(j);
+      };
+      for (auto it = edgesBegin(i); it != edgesEnd(i); it++) {
+        mark(*it);
+        for (const auto& j : successors[*it]) {
+          mark(j);
+        }
+      }
+      for (const auto& j : res) {
+        visited[j / 64] = 0;
+      }
+      std::sort(res.begin(), res.end());
+    }
+  }
+
+  _successorOffsets.assign(n + 1, 0);
+  for (index_t i = 0; i < n; i++) {
+    _successorOffsets[i + 1] = _successorOffsets[i] + successors[i].size();
+  }
+  _successors.clear();
+  _successors.reserve(_successorOffsets[n]);
+  for (auto& s : successors) {
+    _successors.insert(_successors.end(), s.begin(), s.end());
+    s = {};
   }
   _preparedFast = true;
 }
@@ -151,23 +314,31 @@ size_t osm2rdf::util::DirectedGraph<T>::getNumEdges() const {
 // ____________________________________________________________________________
 template <typename T>
 size_t osm2rdf::util::DirectedGraph<T>::getNumVertices() const {
-  return _adjacency.size();
+  assert(_frozen);
+  return _vertices.size();
 }
 
 // ____________________________________________________________________________
 template <typename T>
 std::vector<T> osm2rdf::util::DirectedGraph<T>::getVertices() const {
-  std::vector<T> result;
-  for (const auto& [key, _] : _adjacency) {
-    result.push_back(key);
-  }
-  return result;
+  assert(_frozen);
+  return _vertices;
 }
 
 // ____________________________________________________________________________
 template <typename T>
 std::vector<T> osm2rdf::util::DirectedGraph<T>::getEdges(T src) const {
-  return _adjacency.at(src);
+  assert(_frozen);
+  index_t i;
+  if (!findIndex(src, &i)) {
+    throw std::out_of_range("Unknown vertex");
+  }
+  std::vector<T> res;
+  res.reserve(edgesEnd(i) - edgesBegin(i));
+  for (auto it = edgesBegin(i); it != edgesEnd(i); it++) {
+    res.push_back(_vertices[*it]);
+  }
+  return res;
 }
 
 // ____________________________________________________________________________
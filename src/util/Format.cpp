@@ -0,0 +1,108 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "osm2rdf/util/Format.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+static const int64_t POW10[] = {1,         10,         100,      1000,
+                                10000,     100000,     1000000,  10000000,
+                                100000000, 1000000000};
+
+// ____________________________________________________________________________
+size_t osm2rdf::util::formatFloat(double v, size_t prec, char* buf,
+                                  bool trimZeros) {
+  size_t len = 0;
+#if defined(__cpp_lib_to_chars)
+  auto res = std::to_chars(buf, buf + FORMAT_BUFFER_SIZE, v,
+                           std::chars_format::fixed, static_cast<int>(prec));
+  if (res.ec != std::errc()) {
+    res = std::to_chars(buf, buf + FORMAT_BUFFER_SIZE, v);
+  }
+  len = res.ptr - buf;
+#else
+  int n = snprintf(buf, FORMAT_BUFFER_SIZE, "%.*f", static_cast<int>(prec), v);
+  if (n < 0 || static_cast<size_t>(n) >= FORMAT_BUFFER_SIZE) {
+    n = snprintf(buf, FORMAT_BUFFER_SIZE, "%.17g", v);
+  }
+  len = static_cast<size_t>(n);
+#endif
+  if (trimZeros && memchr(buf, '.', len) != nullptr &&
+      memchr(buf, 'e', len) == nullptr) {
+    while (buf[len - 1] == '0') len--;
+    if (buf[len - 1] == '.') len--;
+  }
+  return len;
+}
+
+// ____________________________________________________________________________
+size_t osm2rdf::util::formatFixed(double v, size_t prec, char* buf) {
+  if (prec > FIXED_MAX_PRECISION) return formatFloat(v, prec, buf);
+
+  const double scaled = std::abs(v) * static_cast<double>(POW10[prec]);
+  // Also catches NaN.
+  if (!(scaled < 1e18)) return formatFloat(v, prec, buf);
+
+  // The product above may be off by half an ulp. If it is that close to a
+  // tie between two outputs, the rounding direction depends on the exact
+  // decimal value of v, which only formatFloat knows.
+  const double frac = scaled - std::floor(scaled);
+  if (std::abs(frac - 0.5) <= scaled * std::numeric_limits<double>::epsilon()) {
+    return formatFloat(v, prec, buf);
+  }
+
+  uint64_t abs = static_cast<uint64_t>(scaled) + (frac > 0.5 ? 1 : 0);
+  char* c = buf;
+  // Like printf, negative values rounding to zero keep their sign.
+  if (std::signbit(v)) {
+    *c++ = '-';
+  }
+
+  uint64_t intPart = abs / POW10[prec];
+  uint64_t fracPart = abs % POW10[prec];
+
+  // Integer part, written backwards into a scratch buffer.
+  char tmp[20];
+  size_t n = 0;
+  do {
+    tmp[n++] = static_cast<char>('0' + intPart % 10);
+    intPart /= 10;
+  } while (intPart > 0);
+  while (n > 0) *c++ = tmp[--n];
+
+  if (fracPart > 0) {
+    size_t digits = prec;
+    while (fracPart % 10 == 0) {
+      fracPart /= 10;
+      digits--;
+    }
+    *c++ = '.';
+    for (size_t i = digits; i > 0; i--) {
+      c[i - 1] = static_cast<char>('0' + fracPart % 10);
+      fracPart /= 10;
+    }
+    c += digits;
+  }
+
+  return c - buf;
+}
@@ -121,8 +121,8 @@ void osm2rdf::util::Output::close() {
   if (_toStdOut) {
     for (size_t i = 0; i < _partCount; ++i) {
       _lines[i] = 0;
-      _outBuffers[i][_outBufPos[i]] = '\0';
-      std::cout << reinterpret_cast<const char*>(_outBuffers[i]);
+      std::cout.write(reinterpret_cast<const char*>(_outBuffers[i]),
+                      _outBufPos[i]);
     }
   } else if (_config.outputCompress == BZ2) {
 #pragma omp parallel for
@@ -206,9 +206,39 @@ void osm2rdf::util::Output::concatenate() {
   _outFile.flush();
 }
 
+// ____________________________________________________________________________
+bool osm2rdf::util::Output::merge(const std::vector<std::string>& files,
+                                  const std::filesystem::path& target) {
+  std::ofstream outFile{target, std::ofstream::out | std::ofstream::trunc |
+                                    std::ofstream::binary};
+  if (!outFile.is_open()) {
+    std::cerr << "Can't open final output file: " << target << std::endl;
+    return false;
+  }
+
+  for (const auto& filename : files) {
+    std::ifstream inFile{filename, std::ifstream::binary};
+    if (!inFile.is_open() || !inFile.good()) {
+      std::cerr << "Error opening file: " << filename << std::endl;
+      return false;
+    }
+    if (inFile.peek() != std::ifstream::traits_type::eof()) {
+      outFile << inFile.rdbuf();
+    }
+  }
+
+  outFile.flush();
+  return outFile.good();
+}
+
 // ____________________________________________________________________________
 void osm2rdf::util::Output::writeNewLine(size_t part) {
   write('\n', part);
+  writeRecordEnd(part);
+}
+
+// ____________________________________________________________________________
+void osm2rdf::util::Output::writeRecordEnd(size_t part) {
   _lines[part]++;
   if (_toStdOut) {
     // flush as soon as only half of the buffer is available
@@ -309,8 +339,8 @@ void osm2rdf::util::Output::flush() {
 void osm2rdf::util::Output::flush(size_t i) {
   if (_toStdOut) {
     _lines[i] = 0;
-    _outBuffers[i][_outBufPos[i]] = '\0';
-    std::cout << reinterpret_cast<const char*>(_outBuffers[i]);
+    std::cout.write(reinterpret_cast<const char*>(_outBuffers[i]),
+                    _outBufPos[i]);
   } else {
 		writeToFile(_outBuffers[i], _outBufPos[i], i);
   }
@@ -0,0 +1,40 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "osm2rdf/util/Projection.h"
+
+#include <cmath>
+
+// Same constants and order of operations as ::util::geo::latLngToWebMerc,
+// the spatial relations rely on identical coordinates for all inputs.
+static const double WEB_MERC_R = 6378137.0;
+static const double WEB_MERC_R_HALF = 3189068.5;
+static const double DEG_TO_RAD = 0.017453292519943295;
+
+// ____________________________________________________________________________
+void osm2rdf::util::projectWebMercBatch(const double* lngLat,
+                                        ::util::geo::I32Point* out, size_t n,
+                                        double prec) {
+  for (size_t i = 0; i < n; i++) {
+    const double x = WEB_MERC_R * lngLat[2 * i] * DEG_TO_RAD;
+    const double s = sin(lngLat[2 * i + 1] * DEG_TO_RAD);
+    const double y = WEB_MERC_R_HALF * log((1.0 + s) / (1.0 - s));
+    out[i] = ::util::geo::I32Point{static_cast<int32_t>(x * prec),
+                                   static_cast<int32_t>(y * prec)};
+  }
+}
@@ -0,0 +1,191 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "osm2rdf/util/Scan.h"
+
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// ____________________________________________________________________________
+inline bool isLiteralEscape(unsigned char c) {
+  return c == '"' || c == '\\' || c == '\n' || c == '\r';
+}
+
+// ____________________________________________________________________________
+inline bool isIRIREFEscape(unsigned char c) {
+  return c <= ' ' || c == '<' || c == '>' || c == '"' || c == '{' ||
+         c == '}' || c == '|' || c == '^' || c == '`' || c == '\\';
+}
+
+// ____________________________________________________________________________
+inline bool isPNLocalSpecial(unsigned char c) {
+  return !((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+           (c >= '0' && c <= '9') || c == '_' || c == ':');
+}
+
+// ____________________________________________________________________________
+template <bool (*IS)(unsigned char)>
+size_t findScalar(std::string_view s, size_t pos) {
+  for (; pos < s.size(); ++pos) {
+    if (IS(static_cast<unsigned char>(s[pos]))) {
+      return pos;
+    }
+  }
+  return s.size();
+}
+
+#if defined(__AVX2__)
+// ____________________________________________________________________________
+inline __m256i eq(__m256i v, char c) {
+  return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c));
+}
+
+// ____________________________________________________________________________
+inline __m256i inRange(__m256i v, char lo, char hi) {
+  // unsigned lo <= v <= hi  <=>  v - lo <= hi - lo
+  const __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+  return _mm256_cmpeq_epi8(
+      _mm256_min_epu8(d, _mm256_set1_epi8(static_cast<char>(hi - lo))), d);
+}
+
+// ____________________________________________________________________________
+inline uint32_t literalMask(__m256i v) {
+  return _mm256_movemask_epi8(
+      _mm256_or_si256(_mm256_or_si256(eq(v, '"'), eq(v, '\\')),
+                      _mm256_or_si256(eq(v, '\n'), eq(v, '\r'))));
+}
+
+// ____________________________________________________________________________
+inline uint32_t irirefMask(__m256i v) {
+  __m256i m = _mm256_or_si256(inRange(v, 0, ' '), inRange(v, '{', '}'));
+  m = _mm256_or_si256(m, _mm256_or_si256(eq(v, '"'), eq(v, '<')));
+  m = _mm256_or_si256(m, _mm256_or_si256(eq(v, '>'), eq(v, '\\')));
+  m = _mm256_or_si256(m, _mm256_or_si256(eq(v, '^'), eq(v, '`')));
+  return _mm256_movemask_epi8(m);
+}
+
+// ____________________________________________________________________________
+inline uint32_t pnLocalMask(__m256i v) {
+  const __m256i m =
+      _mm256_or_si256(_mm256_or_si256(inRange(v, '0', ':'), eq(v, '_')),
+                      _mm256_or_si256(inRange(v, 'A', 'Z'),
+                                      inRange(v, 'a', 'z')));
+  return ~static_cast<uint32_t>(_mm256_movemask_epi8(m));
+}
+
+// ____________________________________________________________________________
+template <uint32_t (*MASK)(__m256i), bool (*IS)(unsigned char)>
+size_t find(std::string_view s) {
+  size_t pos = 0;
+  for (; pos + sizeof(__m256i) <= s.size(); pos += sizeof(__m256i)) {
+    const uint32_t mask = MASK(_mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(s.data() + pos)));
+    if (mask != 0) {
+      return pos + __builtin_ctz(mask);
+    }
+  }
+  return findScalar<IS>(s, pos);
+}
+#elif defined(__SSE4_2__)
+// Needles for _mm_cmpestri, padded to 16 bytes.
+const char LITERAL_SET[16] = {'"', '\\', '\n', '\r'};
+const int LITERAL_MODE =
+    _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT;
+const char IRIREF_RANGES[16] = {0x00, ' ', '"', '"', '<',  '<', '>', '>',
+                                '\\', '\\', '^', '^', '`', '`', '{', '}'};
+const int IRIREF_MODE =
+    _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_LEAST_SIGNIFICANT;
+const char PN_LOCAL_RANGES[16] = {'0', ':', 'A', 'Z', '_', '_', 'a', 'z'};
+const int PN_LOCAL_MODE = _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES |
+                          _SIDD_MASKED_NEGATIVE_POLARITY |
+                          _SIDD_LEAST_SIGNIFICANT;
+
+// ____________________________________________________________________________
+template <int MODE, bool (*IS)(unsigned char)>
+size_t find(std::string_view s, const char* set, int setSize) {
+  const __m128i needles =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(set));
+  size_t pos = 0;
+  for (; pos + sizeof(__m128i) <= s.size(); pos += sizeof(__m128i)) {
+    const int i = _mm_cmpestri(
+        needles, setSize,
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + pos)),
+        sizeof(__m128i), MODE);
+    if (i < static_cast<int>(sizeof(__m128i))) {
+      return pos + i;
+    }
+  }
+  return findScalar<IS>(s, pos);
+}
+#endif
+
+}  // namespace
+
+// ____________________________________________________________________________
+size_t osm2rdf::util::findLiteralEscape(std::string_view s) {
+#if defined(__AVX2__)
+  return find<literalMask, isLiteralEscape>(s);
+#elif defined(__SSE4_2__)
+  return find<LITERAL_MODE, isLiteralEscape>(s, LITERAL_SET, 4);
+#else
+  return findScalar<isLiteralEscape>(s, 0);
+#endif
+}
+
+// ____________________________________________________________________________
+size_t osm2rdf::util::findIRIREFEscape(std::string_view s) {
+#if defined(__AVX2__)
+  return find<irirefMask, isIRIREFEscape>(s);
+#elif defined(__SSE4_2__)
+  return find<IRIREF_MODE, isIRIREFEscape>(s, IRIREF_RANGES, 16);
+#else
+  return findScalar<isIRIREFEscape>(s, 0);
+#endif
+}
+
+// ____________________________________________________________________________
+size_t osm2rdf::util::findPNLocalSpecial(std::string_view s) {
+#if defined(__AVX2__)
+  return find<pnLocalMask, isPNLocalSpecial>(s);
+#elif defined(__SSE4_2__)
+  return find<PN_LOCAL_MODE, isPNLocalSpecial>(s, PN_LOCAL_RANGES, 8);
+#else
+  return findScalar<isPNLocalSpecial>(s, 0);
+#endif
+}
+
+// ____________________________________________________________________________
+size_t osm2rdf::util::findLiteralEscapeScalar(std::string_view s) {
+  return findScalar<isLiteralEscape>(s, 0);
+}
+
+// ____________________________________________________________________________
+size_t osm2rdf::util::findIRIREFEscapeScalar(std::string_view s) {
+  return findScalar<isIRIREFEscape>(s, 0);
+}
+
+// ____________________________________________________________________________
+size_t osm2rdf::util::findPNLocalSpecialScalar(std::string_view s) {
+  return findScalar<isPNLocalSpecial>(s, 0);
+}
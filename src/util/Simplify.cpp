@@ -0,0 +1,158 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "osm2rdf/util/Simplify.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+// Number of points of the smallest valid (closed) ring.
+static const size_t MIN_RING_POINTS = 4;
+// Number of points of the smallest valid line.
+static const size_t MIN_LINE_POINTS = 2;
+
+namespace {
+
+// A segment between two kept points, with the point in between which
+// deviates most from it.
+struct Segment {
+  double deviation;
+  uint32_t from;
+  uint32_t to;
+  uint32_t farthest;
+
+  bool operator<(const Segment& other) const {
+    return deviation < other.deviation;
+  }
+};
+
+// ____________________________________________________________________________
+double distToSegment(const ::util::geo::DPoint& a, const ::util::geo::DPoint& b,
+                     const ::util::geo::DPoint& p) {
+  const double dx = b.getX() - a.getX();
+  const double dy = b.getY() - a.getY();
+  const double len2 = dx * dx + dy * dy;
+  double t = 0;
+  if (len2 > 0) {
+    t = ((p.getX() - a.getX()) * dx + (p.getY() - a.getY()) * dy) / len2;
+    t = std::max(0.0, std::min(1.0, t));
+  }
+  return std::hypot(p.getX() - (a.getX() + t * dx),
+                    p.getY() - (a.getY() + t * dy));
+}
+
+// ____________________________________________________________________________
+Segment farthest(const ::util::geo::DLine& line, uint32_t from, uint32_t to) {
+  Segment seg{-1, from, to, from};
+  for (uint32_t i = from + 1; i < to; i++) {
+    const double d = distToSegment(line[from], line[to], line[i]);
+    // first point wins on ties, as in the recursive algorithm
+    if (d > seg.deviation) {
+      seg.deviation = d;
+      seg.farthest = i;
+    }
+  }
+  return seg;
+}
+
+}  // namespace
+
+// ____________________________________________________________________________
+::util::geo::DLine osm2rdf::util::simplify(const ::util::geo::DLine& line,
+                                           double maxDeviation,
+                                           size_t minPoints) {
+  if (line.size() < 3 || line.size() <= minPoints) return line;
+
+  std::vector<bool> keep(line.size(), false);
+  keep.front() = true;
+  keep.back() = true;
+  size_t kept = 2;
+
+  std::priority_queue<Segment> heap;
+  heap.push(farthest(line, 0, line.size() - 1));
+
+  while (!heap.empty()) {
+    const Segment seg = heap.top();
+    if (seg.deviation <= maxDeviation && kept >= minPoints) break;
+    heap.pop();
+
+    keep[seg.farthest] = true;
+    kept++;
+    if (seg.farthest - seg.from > 1) {
+      heap.push(farthest(line, seg.from, seg.farthest));
+    }
+    if (seg.to - seg.farthest > 1) {
+      heap.push(farthest(line, seg.farthest, seg.to));
+    }
+  }
+
+  ::util::geo::DLine res;
+  res.reserve(kept);
+  for (size_t i = 0; i < line.size(); i++) {
+    if (keep[i]) res.push_back(line[i]);
+  }
+  return res;
+}
+
+// ____________________________________________________________________________
+::util::geo::DLine osm2rdf::util::simplify(const ::util::geo::DLine& line,
+                                           double maxDeviation) {
+  return simplify(line, maxDeviation, MIN_LINE_POINTS);
+}
+
+// ____________________________________________________________________________
+::util::geo::DPolygon osm2rdf::util::simplify(
+    const ::util::geo::DPolygon& polygon, double maxDeviation) {
+  ::util::geo::DPolygon res;
+  res.getOuter() = simplify(polygon.getOuter(), maxDeviation, MIN_RING_POINTS);
+  res.getInners().reserve(polygon.getInners().size());
+  for (const auto& inner : polygon.getInners()) {
+    res.getInners().push_back(simplify(inner, maxDeviation, MIN_RING_POINTS));
+  }
+  return res;
+}
+
+// ____________________________________________________________________________
+::util::geo::DMultiPolygon osm2rdf::util::simplify(
+    const ::util::geo::DMultiPolygon& multiPolygon, double maxDeviation) {
+  ::util::geo::DMultiPolygon res;
+  res.reserve(multiPolygon.size());
+  for (const auto& polygon : multiPolygon) {
+    res.push_back(simplify(polygon, maxDeviation));
+  }
+  return res;
+}
+
+// ____________________________________________________________________________
+::util::geo::DCollection osm2rdf::util::simplify(
+    const ::util::geo::DCollection& collection, double maxDeviation) {
+  ::util::geo::DCollection res;
+  res.reserve(collection.size());
+  for (const auto& geom : collection) {
+    // relations only consist of points and lines, everything else is kept
+    if (geom.getType() == 1) {
+      res.push_back(simplify(geom.getLine(), maxDeviation));
+    } else {
+      res.push_back(geom);
+    }
+  }
+  return res;
+}
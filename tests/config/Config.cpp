@@ -45,19 +45,30 @@ void assertDefaultConfig(const osm2rdf::config::Config& config) {
   ASSERT_TRUE(config.addMemberTriples);
   ASSERT_FALSE(config.addWayNodeSpatialMetadata);
   ASSERT_FALSE(config.addWayMetadata);
+  ASSERT_FALSE(config.skolemizeMembers);
   ASSERT_FALSE(config.skipWikiLinks);
 
   ASSERT_EQ(0, config.semicolonTagKeys.size());
 
   ASSERT_FALSE(config.writeRDFStatistics);
 
-  ASSERT_EQ(0, config.simplifyGeometries);
+  ASSERT_FALSE(config.simplifyGeometries);
+  ASSERT_EQ(0, config.spatialStripe);
+  ASSERT_EQ(0, config.numSpatialStripes);
+  ASSERT_TRUE(config.mergeSpatialStripes.empty());
+  ASSERT_TRUE(config.auxGeoFiles.empty());
+  ASSERT_FALSE(config.auxGeoFilesCache);
+  ASSERT_FALSE(config.reduceContains);
   ASSERT_EQ(0, config.simplifyWKT);
   ASSERT_EQ(5, config.wktDeviation);
   ASSERT_EQ(7, config.wktPrecision);
 
   ASSERT_EQ(osm2rdf::util::OutputMergeMode::CONCATENATE, config.mergeOutput);
   ASSERT_TRUE(config.outputCompress);
+  ASSERT_EQ("", config.spatialRelationsOutput);
+  ASSERT_EQ(osm2rdf::util::OutputMergeMode::CONCATENATE,
+            config.spatialRelationsMergeOutput);
+  ASSERT_FALSE(config.outputGroupSubjects);
   ASSERT_FALSE(config.outputKeepFiles);
 
   ASSERT_EQ(std::filesystem::temp_directory_path(), config.cache);
@@ -189,6 +200,81 @@ TEST(CONFIG_Config, fromArgsOutputCompressIgnoreExtensionOnStdout) {
   ASSERT_EQ("", config.output.string());
 }
 
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsSpatialRelationsOutputLong) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile dummyInput("/tmp/dummyInput");
+
+  const auto arg = "-" + osm2rdf::config::constants::OUTPUT_OPTION_SHORT;
+  const auto arg2 =
+      "--" + osm2rdf::config::constants::SPATIAL_RELATIONS_OUTPUT_OPTION_LONG;
+  const int argc = 6;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("/tmp/output"),
+                      const_cast<char*>(arg2.c_str()),
+                      const_cast<char*>("/tmp/relations"),
+                      const_cast<char*>("/tmp/dummyInput")};
+  config.fromArgs(argc, argv);
+  ASSERT_EQ("/tmp/output.bz2", config.output.string());
+  ASSERT_EQ("/tmp/relations.bz2", config.spatialRelationsOutput.string());
+  ASSERT_EQ(osm2rdf::config::BZ2, config.spatialRelationsOutputCompress);
+}
+
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsSpatialRelationsOutputCompressLong) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile dummyInput("/tmp/dummyInput");
+
+  const auto arg = "-" + osm2rdf::config::constants::OUTPUT_OPTION_SHORT;
+  const auto arg2 =
+      "--" + osm2rdf::config::constants::SPATIAL_RELATIONS_OUTPUT_OPTION_LONG;
+  const auto arg3 =
+      "--" +
+      osm2rdf::config::constants::SPATIAL_RELATIONS_OUTPUT_COMPRESS_OPTION_LONG;
+  const int argc = 8;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("/tmp/output"),
+                      const_cast<char*>(arg2.c_str()),
+                      const_cast<char*>("/tmp/relations"),
+                      const_cast<char*>(arg3.c_str()),
+                      const_cast<char*>("gz"),
+                      const_cast<char*>("/tmp/dummyInput")};
+  config.fromArgs(argc, argv);
+  ASSERT_EQ("/tmp/output.bz2", config.output.string());
+  ASSERT_EQ("/tmp/relations.gz", config.spatialRelationsOutput.string());
+  ASSERT_EQ(osm2rdf::config::GZ, config.spatialRelationsOutputCompress);
+}
+
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsSpatialRelationsOutputStdOut) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile dummyInput("/tmp/dummyInput");
+
+  const auto arg =
+      "--" + osm2rdf::config::constants::SPATIAL_RELATIONS_OUTPUT_OPTION_LONG;
+  const int argc = 4;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("/tmp/relations"),
+                      const_cast<char*>("/tmp/dummyInput")};
+  config.fromArgs(argc, argv);
+  ASSERT_EQ("", config.output.string());
+  ASSERT_EQ(osm2rdf::config::NONE, config.outputCompress);
+  ASSERT_EQ(osm2rdf::util::OutputMergeMode::NONE, config.mergeOutput);
+  ASSERT_EQ("/tmp/relations.bz2", config.spatialRelationsOutput.string());
+
+  // The separate output is still merged into a single file
+  const auto relConfig = config.getSpatialRelationsConfig();
+  ASSERT_EQ("/tmp/relations.bz2", relConfig.output.string());
+  ASSERT_EQ(osm2rdf::config::BZ2, relConfig.outputCompress);
+  ASSERT_EQ(osm2rdf::util::OutputMergeMode::CONCATENATE,
+            relConfig.mergeOutput);
+  ASSERT_EQ("/tmp/relations.bz2.stats.json",
+            relConfig.rdfStatisticsPath.string());
+}
+
 // ____________________________________________________________________________
 TEST(CONFIG_Config, fromArgsCacheNotFoundShort) {
   osm2rdf::config::Config config;
@@ -609,6 +695,22 @@ TEST(CONFIG_Config, fromArgsAddWayNodeSpatialMetadataLong) {
   ASSERT_TRUE(config.addMemberTriples);
 }
 
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsSkolemizeMembersLong) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile cf("/tmp/dummyInput");
+
+  const auto arg =
+      "--" + osm2rdf::config::constants::SKOLEMIZE_MEMBERS_OPTION_LONG;
+  const int argc = 3;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("/tmp/dummyInput")};
+  config.fromArgs(argc, argv);
+  ASSERT_EQ("", config.output.string());
+  ASSERT_TRUE(config.skolemizeMembers);
+}
+
 // ____________________________________________________________________________
 TEST(CONFIG_Config, fromArgsSkipWikiLinksLong) {
   osm2rdf::config::Config config;
@@ -633,13 +735,128 @@ TEST(CONFIG_Config, fromArgsSimplifyGeometriesLong) {
 
   const auto arg =
       "--" + osm2rdf::config::constants::SIMPLIFY_GEOMETRIES_OPTION_LONG;
-  const int argc = 4;
+  const int argc = 3;
   char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
-                      const_cast<char*>("25"),
                       const_cast<char*>("/tmp/dummyInput")};
   config.fromArgs(argc, argv);
   ASSERT_EQ("", config.output.string());
-  ASSERT_EQ(25, config.simplifyGeometries);
+  ASSERT_TRUE(config.simplifyGeometries);
+}
+
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsAuxGeoFilesCacheLong) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile cf("/tmp/dummyInput");
+
+  const auto arg =
+      "--" + osm2rdf::config::constants::AUX_GEO_FILES_OPTION_LONG;
+  const auto arg2 =
+      "--" + osm2rdf::config::constants::AUX_GEO_FILES_CACHE_OPTION_LONG;
+  const int argc = 5;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("/tmp/aux.wkt"),
+                      const_cast<char*>(arg2.c_str()),
+                      const_cast<char*>("/tmp/dummyInput")};
+  config.fromArgs(argc, argv);
+  ASSERT_EQ(1, config.auxGeoFiles.size());
+  ASSERT_EQ("/tmp/aux.wkt", config.auxGeoFiles[0]);
+  ASSERT_TRUE(config.auxGeoFilesCache);
+}
+
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsReduceContainsLong) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile cf("/tmp/dummyInput");
+
+  const auto arg =
+      "--" + osm2rdf::config::constants::REDUCE_CONTAINS_OPTION_LONG;
+  const int argc = 3;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("/tmp/dummyInput")};
+  config.fromArgs(argc, argv);
+  ASSERT_TRUE(config.reduceContains);
+}
+
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsSpatialStripeLong) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile cf("/tmp/dummyInput");
+
+  const auto arg =
+      "--" + osm2rdf::config::constants::SPATIAL_STRIPE_OPTION_LONG;
+  const int argc = 4;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("2/8"),
+                      const_cast<char*>("/tmp/dummyInput")};
+  config.fromArgs(argc, argv);
+  ASSERT_EQ(2, config.spatialStripe);
+  ASSERT_EQ(8, config.numSpatialStripes);
+  // Facts are only written by the first stripe
+  ASSERT_TRUE(config.noFacts);
+}
+
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsSpatialStripeFirstKeepsFacts) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile cf("/tmp/dummyInput");
+
+  const auto arg =
+      "--" + osm2rdf::config::constants::SPATIAL_STRIPE_OPTION_LONG;
+  const int argc = 4;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("0/8"),
+                      const_cast<char*>("/tmp/dummyInput")};
+  config.fromArgs(argc, argv);
+  ASSERT_EQ(0, config.spatialStripe);
+  ASSERT_EQ(8, config.numSpatialStripes);
+  ASSERT_FALSE(config.noFacts);
+}
+
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsSpatialStripeInvalid) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile cf("/tmp/dummyInput");
+
+  const auto arg =
+      "--" + osm2rdf::config::constants::SPATIAL_STRIPE_OPTION_LONG;
+  const int argc = 4;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("8/8"),
+                      const_cast<char*>("/tmp/dummyInput")};
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+  ASSERT_EXIT(config.fromArgs(argc, argv),
+              ::testing::ExitedWithCode(osm2rdf::config::ExitCode::FAILURE),
+              "^Invalid Option Exception:");
+}
+
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsMergeSpatialStripesLong) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile cf1("/tmp/dummyStripe0");
+  osm2rdf::util::CacheFile cf2("/tmp/dummyStripe1");
+
+  const auto arg =
+      "--" + osm2rdf::config::constants::MERGE_SPATIAL_STRIPES_OPTION_LONG;
+  const auto outArg = "--" + osm2rdf::config::constants::OUTPUT_OPTION_LONG;
+  const int argc = 7;
+  char* argv[argc] = {const_cast<char*>(""),
+                      const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("/tmp/dummyStripe0"),
+                      const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("/tmp/dummyStripe1"),
+                      const_cast<char*>(outArg.c_str()),
+                      const_cast<char*>("/tmp/dummyMerged")};
+  config.fromArgs(argc, argv);
+  ASSERT_EQ(2, config.mergeSpatialStripes.size());
+  ASSERT_EQ("/tmp/dummyStripe0", config.mergeSpatialStripes[0]);
+  ASSERT_EQ("/tmp/dummyStripe1", config.mergeSpatialStripes[1]);
+  ASSERT_TRUE(config.input.empty());
 }
 
 // ____________________________________________________________________________
@@ -746,6 +963,21 @@ TEST(CONFIG_Config, fromArgsWriteRDFRelationStatisticsLong) {
   ASSERT_TRUE(config.writeRDFStatistics);
 }
 
+// ____________________________________________________________________________
+TEST(CONFIG_Config, fromArgsOutputGroupSubjectsLong) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  osm2rdf::util::CacheFile cf("/tmp/dummyInput");
+
+  const auto arg =
+      "--" + osm2rdf::config::constants::OUTPUT_GROUP_SUBJECTS_OPTION_LONG;
+  const int argc = 3;
+  char* argv[argc] = {const_cast<char*>(""), const_cast<char*>(arg.c_str()),
+                      const_cast<char*>("/tmp/dummyInput")};
+  config.fromArgs(argc, argv);
+  ASSERT_TRUE(config.outputGroupSubjects);
+}
+
 // ____________________________________________________________________________
 TEST(CONFIG_Config, fromArgsOutputKeepFilesLong) {
   osm2rdf::config::Config config;
@@ -910,13 +1142,36 @@ TEST(CONFIG_Config, getInfoSemicolonTagKeys) {
 TEST(CONFIG_Config, getInfoSimplifyGeometries) {
   osm2rdf::config::Config config;
   assertDefaultConfig(config);
-  config.simplifyGeometries = 250;
+  config.simplifyGeometries = true;
 
   const std::string res = config.getInfo("");
   ASSERT_THAT(res, ::testing::HasSubstr(
                        osm2rdf::config::constants::SIMPLIFY_GEOMETRIES_INFO));
 }
 
+// ____________________________________________________________________________
+TEST(CONFIG_Config, getInfoSpatialStripe) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  config.spatialStripe = 3;
+  config.numSpatialStripes = 4;
+
+  const std::string res = config.getInfo("");
+  ASSERT_THAT(res, ::testing::HasSubstr(
+                       osm2rdf::config::constants::SPATIAL_STRIPE_INFO + "3/4"));
+}
+
+// ____________________________________________________________________________
+TEST(CONFIG_Config, getInfoReduceContains) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  config.reduceContains = true;
+
+  const std::string res = config.getInfo("");
+  ASSERT_THAT(res, ::testing::HasSubstr(
+                       osm2rdf::config::constants::REDUCE_CONTAINS_INFO));
+}
+
 // ____________________________________________________________________________
 TEST(CONFIG_Config, getInfoSimplifyWKT) {
   osm2rdf::config::Config config;
@@ -928,6 +1183,17 @@ TEST(CONFIG_Config, getInfoSimplifyWKT) {
       res, ::testing::HasSubstr(osm2rdf::config::constants::SIMPLIFY_WKT_INFO));
 }
 
+// ____________________________________________________________________________
+TEST(CONFIG_Config, getInfoSkolemizeMembers) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  config.skolemizeMembers = true;
+
+  const std::string res = config.getInfo("");
+  ASSERT_THAT(res, ::testing::HasSubstr(
+                       osm2rdf::config::constants::SKOLEMIZE_MEMBERS_INFO));
+}
+
 // ____________________________________________________________________________
 TEST(CONFIG_Config, getInfoSkipWikiLinks) {
   osm2rdf::config::Config config;
@@ -986,6 +1252,19 @@ TEST(CONFIG_Config, getInfoWriteRDFStatistics) {
                        osm2rdf::config::constants::WRITE_RDF_STATISTICS_INFO));
 }
 
+// ____________________________________________________________________________
+TEST(CONFIG_Config, getInfoOutputGroupSubjects) {
+  osm2rdf::config::Config config;
+  assertDefaultConfig(config);
+  config.outputGroupSubjects = true;
+
+  const std::string res = config.getInfo("");
+
+  ASSERT_THAT(
+      res, ::testing::HasSubstr(
+               osm2rdf::config::constants::OUTPUT_GROUP_SUBJECTS_OPTION_INFO));
+}
+
 // ____________________________________________________________________________
 TEST(CONFIG_Config, getInfoOutputKeepFiles) {
   osm2rdf::config::Config config;
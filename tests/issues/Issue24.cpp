@@ -62,7 +62,6 @@ TEST(Issue24, areaFromWayHasGeometryAsGeoSPARQL) {
 
   // Create osm2rdf object from osmium object
   osm2rdf::osm::Area a{osmiumBuffer.get<osmium::Area>(0)};
-  a.finalize();
 
   dh.area(a);
   output.flush();
@@ -121,7 +120,6 @@ TEST(Issue24, areaFromRelationHasGeometryAsGeoSPARQL) {
 
   // Create osm2rdf object from osmium object
   osm2rdf::osm::Area a{osmiumBuffer.get<osmium::Area>(0)};
-  a.finalize();
 
   dh.area(a);
   output.flush();
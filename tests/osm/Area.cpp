@@ -41,7 +41,6 @@ TEST(OSM_Area, FromAreaVirtualWay) {
 
   // Create osm2rdf object from osmium object
   osm2rdf::osm::Area a{osmiumBuffer.get<osmium::Area>(0)};
-  a.finalize();
   ASSERT_EQ(42, a.id());
   ASSERT_EQ(21, a.objId());
   ASSERT_TRUE(a.fromWay());
@@ -68,7 +67,6 @@ TEST(OSM_Area, FromAreaVirtualRelation) {
 
   // Create osm2rdf object from osmium object
   osm2rdf::osm::Area a{osmiumBuffer.get<osmium::Area>(0)};
-  a.finalize();
   ASSERT_EQ(43, a.id());
   ASSERT_EQ(21, a.objId());
   ASSERT_FALSE(a.fromWay());
@@ -98,7 +96,6 @@ TEST(OSM_Area, BoundaryWithAdminLevel) {
 
   // Create osm2rdf object from osmium object
   osm2rdf::osm::Area a{osmiumBuffer.get<osmium::Area>(0)};
-  a.finalize();
   ASSERT_EQ(43, a.id());
   ASSERT_EQ(21, a.objId());
   ASSERT_FALSE(a.fromWay());
@@ -18,6 +18,8 @@
 
 #include "osm2rdf/osm/FactHandler.h"
 
+#include <random>
+
 #include "gmock/gmock-matchers.h"
 #include "gtest/gtest.h"
 #include "osmium/builder/attr.hpp"
@@ -84,7 +86,6 @@ TEST(OSM_FactHandler, areaFromWay) {
 
   // Create osm2rdf object from osmium object
   osm2rdf::osm::Area a{osmiumBuffer.get<osmium::Area>(0)};
-  a.finalize();
 
   dh.area(a);
   output.flush();
@@ -148,7 +149,6 @@ TEST(OSM_FactHandler, areaFromRelation) {
 
   // Create osm2rdf object from osmium object
   osm2rdf::osm::Area a{osmiumBuffer.get<osmium::Area>(0)};
-  a.finalize();
 
   dh.area(a);
   output.flush();
@@ -613,6 +613,77 @@ TEST(OSM_FactHandler, wayAddWayNodeOrder) {
   std::cout.rdbuf(sbuf);
 }
 
+// ____________________________________________________________________________
+TEST(OSM_FactHandler, wayAddWayNodeOrderSkolem) {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+                          // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.addCentroid = false;
+  config.addEnvelope = true;
+  config.addConvexHull = true;
+  config.addObb = true;
+  config.addZeroFactNumber = true;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+  config.wktPrecision = 1;
+  config.addMemberTriples = true;
+  config.skolemizeMembers = true;
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL> writer{config, &output};
+  osm2rdf::osm::FactHandler dh{config, &writer};
+
+  // Create osmium object
+  const size_t initial_buffer_size = 10000;
+  osmium::memory::Buffer osmiumBuffer{initial_buffer_size,
+                                      osmium::memory::Buffer::auto_grow::yes};
+  osmium::builder::add_way(osmiumBuffer, osmium::builder::attr::_id(42),
+                           osmium::builder::attr::_nodes({
+                               {1, {48.0, 7.51}},
+                               {2, {48.1, 7.61}},
+                           }),
+                           osmium::builder::attr::_tag("city", "Freiburg"));
+
+  // Create osm2rdf object from osmium object
+  osm2rdf::osm::Way w{osmiumBuffer.get<osmium::Way>(0)};
+
+  dh.way(w);
+  output.flush();
+  output.close();
+
+  ASSERT_EQ(
+      "osmway:42 rdf:type osm:way .\n"
+      "osmway:42 osmmeta:timestamp \"1970-01-01T00:00:00\"^^xsd:dateTime .\n"
+      "osmway:42 osmmeta:version \"0\"^^xsd:integer .\n"
+      "osmway:42 osmkey:city \"Freiburg\" .\n"
+      "osmway:42 osm2rdf:facts \"1\"^^xsd:integer .\n"
+      "osmway:42 osmway:member osm2rdfmember:osmway_42_0 .\n"
+      "osm2rdfmember:osmway_42_0 osmway:member_id osmnode:1 .\n"
+      "osm2rdfmember:osmway_42_0 osmway:member_pos \"0\"^^xsd:integer .\n"
+      "osmway:42 osmway:member osm2rdfmember:osmway_42_1 .\n"
+      "osm2rdfmember:osmway_42_1 osmway:member_id osmnode:2 .\n"
+      "osm2rdfmember:osmway_42_1 osmway:member_pos \"1\"^^xsd:integer .\n"
+      "osmway:42 geo:hasGeometry osm2rdfgeom:osmway_42 "
+      ".\nosm2rdfgeom:osmway_42 geo:asWKT \"LINESTRING(48 7.5,48.1 "
+      "7.6)\"^^geo:wktLiteral .\nosmway:42 osm2rdfgeom:convex_hull "
+      "\"POLYGON((48 7.5,48.1 7.6,48 7.5))\"^^geo:wktLiteral .\nosmway:42 "
+      "osm2rdfgeom:envelope \"POLYGON((48 7.5,48.1 7.5,48.1 7.6,48 7.6,48 "
+      "7.5))\"^^geo:wktLiteral .\nosmway:42 osm2rdfgeom:obb \"POLYGON((48.1 "
+      "7.6,48.1 7.6,48 7.5,48 7.5,48.1 7.6))\"^^geo:wktLiteral .\nosmway:42 "
+      "osm2rdf:length \"15674.68\"^^xsd:double .\n",
+      buffer.str());
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+}
+
 // ____________________________________________________________________________
 TEST(OSM_FactHandler, wayAddWayNodeSpatialMetadataShortWay) {
   // Capture std::cout
@@ -1006,6 +1077,183 @@ TEST(OSM_FactHandler, writeGeometryWaySimplify3) {
   std::cout.rdbuf(sbuf);
 }
 
+// ____________________________________________________________________________
+TEST(OSM_FactHandler, writeGeometryPolygon) {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+                          // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.addCentroid = false;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+  config.wktPrecision = 7;
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL> writer{config, &output};
+  osm2rdf::osm::FactHandler dh{config, &writer};
+
+  const std::string subject = "subject";
+  const std::string predicate = "predicate";
+  ::util::geo::DPolygon polygon;
+  polygon.getOuter().push_back({7.8, 48});
+  polygon.getOuter().push_back({7.9, 48});
+  polygon.getOuter().push_back({7.9, 48.0000001});
+  polygon.getOuter().push_back({7.8, 48});
+  // Unclosed rings are closed on output.
+  polygon.getInners().push_back(
+      {{7.85, 48}, {7.86, 48}, {7.86, -48.0000001}});
+
+  dh.writeGeometry(subject, predicate, polygon);
+  output.flush();
+  output.close();
+
+  ASSERT_EQ(subject + " " + predicate + " " +
+                "\"POLYGON((7.8 48,7.9 48,7.9 48.0000001,7.8 48),(7.85 48,7.86 "
+                "48,7.86 -48.0000001,7.85 48))\"" + "^^" +
+                osm2rdf::ttl::constants::IRI__GEOSPARQL__WKT_LITERAL + " .\n",
+            buffer.str());
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+}
+
+// ____________________________________________________________________________
+TEST(OSM_FactHandler, writeGeometryMultiPolygon) {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+                          // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.addCentroid = false;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+  config.wktPrecision = 2;
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL> writer{config, &output};
+  osm2rdf::osm::FactHandler dh{config, &writer};
+
+  const std::string subject = "subject";
+  const std::string predicate = "predicate";
+  ::util::geo::DMultiPolygon multiPolygon(2);
+  multiPolygon[0].getOuter() = {{0, 0}, {1.0051, 0}, {1, 1}, {0, 0}};
+  multiPolygon[1].getOuter() = {{-5, -5}, {-6.1261, -5}, {-6, -6}, {-5, -5}};
+
+  dh.writeGeometry(subject, predicate, multiPolygon);
+  output.flush();
+  output.close();
+
+  ASSERT_EQ(subject + " " + predicate + " " +
+                "\"MULTIPOLYGON(((0 0,1.01 0,1 1,0 0)),((-5 -5,-6.13 -5,-6 "
+                "-6,-5 -5)))\"" + "^^" +
+                osm2rdf::ttl::constants::IRI__GEOSPARQL__WKT_LITERAL + " .\n",
+            buffer.str());
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+}
+
+// ____________________________________________________________________________
+TEST(OSM_FactHandler, writeGeometryLineHighPrecision) {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+                          // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.addCentroid = false;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+  config.wktPrecision = 12;
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL> writer{config, &output};
+  osm2rdf::osm::FactHandler dh{config, &writer};
+
+  const std::string subject = "subject";
+  const std::string predicate = "predicate";
+  ::util::geo::DLine line;
+  line.push_back({7.5, 48});
+  line.push_back({7.123456789012, 48.1});
+
+  dh.writeGeometry(subject, predicate, line);
+  output.flush();
+  output.close();
+
+  ASSERT_EQ(subject + " " + predicate + " " +
+                "\"LINESTRING(7.5 48,7.123456789012 48.1)\"" + "^^" +
+                osm2rdf::ttl::constants::IRI__GEOSPARQL__WKT_LITERAL + " .\n",
+            buffer.str());
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+}
+
+// ____________________________________________________________________________
+TEST(OSM_FactHandler, writeGeometryLineMatchesGetWKT) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-180, 180);
+  std::uniform_int_distribution<int64_t> digits(-1800000000, 1800000000);
+  ::util::geo::DLine line;
+  for (size_t i = 0; i < 10000; i++) {
+    // random values, values close to a tie and values rounding to zero
+    line.push_back({dist(gen), (digits(gen) + 0.5) / 10000000.0});
+    line.push_back({dist(gen) / 1e9, dist(gen)});
+  }
+
+  for (uint16_t prec = 0; prec <= 9; prec++) {
+    // Capture std::cout
+    std::stringstream buffer;
+    std::streambuf* sbuf = std::cout.rdbuf();
+    std::cout.rdbuf(buffer.rdbuf());
+
+    osm2rdf::config::Config config;
+    config.output = "";
+    config.numThreads = 1;  // set to one to avoid concurrency issues with the
+                            // stringstream read buffer
+    config.outputCompress = osm2rdf::config::NONE;
+    config.addCentroid = false;
+    config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+    config.wktPrecision = prec;
+
+    osm2rdf::util::Output output{config, config.output};
+    output.open();
+    osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL> writer{config, &output};
+    osm2rdf::osm::FactHandler dh{config, &writer};
+
+    const std::string subject = "subject";
+    const std::string predicate = "predicate";
+    dh.writeGeometry(subject, predicate, line);
+    output.flush();
+    output.close();
+
+    // Cleanup
+    std::cout.rdbuf(sbuf);
+
+    ASSERT_EQ(subject + " " + predicate + " \"" +
+                  ::util::geo::getWKT(line, prec) + "\"^^" +
+                  osm2rdf::ttl::constants::IRI__GEOSPARQL__WKT_LITERAL +
+                  " .\n",
+              buffer.str())
+        << "precision " << prec;
+  }
+}
+
 // ____________________________________________________________________________
 TEST(OSM_FactHandler, writeBoxPrecision1) {
   // Capture std::cout
@@ -1523,6 +1771,84 @@ TEST(OSM_FactHandler, writeTag_KeyNotIRI) {
   std::cout.rdbuf(sbuf);
 }
 
+// ____________________________________________________________________________
+TEST(OSM_FactHandler, tagInfo) {
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+  config.semicolonTagKeys.insert("ref");
+
+  osm2rdf::util::Output output{config, config.output};
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL> writer{config, &output};
+  osm2rdf::osm::FactHandler dh{config, &writer};
+
+  typedef osm2rdf::osm::FactHandler<osm2rdf::ttl::format::TTL>::TagType
+      TagType;
+  const auto& info = dh.tagInfo("name:de");
+  ASSERT_EQ(TagType::PLAIN, info.type);
+  ASSERT_EQ("osmkey:name:de", info.predicate);
+  // Cached, the same info is returned.
+  ASSERT_EQ(&info, &dh.tagInfo("name:de"));
+
+  ASSERT_EQ(writer.generateIRI(osm2rdf::ttl::constants::NAMESPACE__OSM_TAG,
+                               "a.b."),
+            dh.tagInfo("a.b.").predicate);
+  ASSERT_EQ("", dh.tagInfo("not:Aß%I.R.I\u2000").predicate);
+
+  ASSERT_EQ(TagType::INTEGER, dh.tagInfo("admin_level").type);
+  ASSERT_EQ("osmkey:admin_level", dh.tagInfo("admin_level").predicate);
+  ASSERT_EQ(TagType::DATE, dh.tagInfo("start_date").type);
+  ASSERT_EQ("osm2rdfkey:start_date", dh.tagInfo("start_date").typedPredicate);
+  ASSERT_EQ(TagType::DATE, dh.tagInfo("end_date").type);
+  ASSERT_EQ(TagType::WIKIDATA, dh.tagInfo("wikidata").type);
+  ASSERT_EQ(TagType::WIKIDATA, dh.tagInfo("brand:wikidata").type);
+  ASSERT_EQ("osm2rdfkey:brand:wikidata",
+            dh.tagInfo("brand:wikidata").typedPredicate);
+  ASSERT_EQ(TagType::WIKIPEDIA, dh.tagInfo("wikipedia").type);
+  ASSERT_EQ(TagType::PLAIN, dh.tagInfo("wikipedia_x").type);
+
+  ASSERT_TRUE(dh.tagInfo("ref").splitValues);
+  ASSERT_FALSE(dh.tagInfo("name:de").splitValues);
+  ASSERT_EQ(11, dh._tagInfos[0].infos.size());
+}
+
+// ____________________________________________________________________________
+TEST(OSM_FactHandler, generateMemberNode) {
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+
+  osm2rdf::util::Output output{config, config.output};
+  {
+    osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT> writer{config, &output};
+    osm2rdf::osm::FactHandler dh{config, &writer};
+    std::string node;
+    dh.generateMemberNode("osmway_42_", 7, &node);
+    ASSERT_EQ("_:0_0", node);
+    dh.generateMemberNode("osmway_42_", 8, &node);
+    ASSERT_EQ("_:0_1", node);
+  }
+
+  config.skolemizeMembers = true;
+  {
+    osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT> writer{config, &output};
+    osm2rdf::osm::FactHandler dh{config, &writer};
+    std::string node;
+    dh.generateMemberNode("osmway_42_", 7, &node);
+    ASSERT_EQ("<https://osm2rdf.cs.uni-freiburg.de/rdf/member#osmway_42_7>",
+              node);
+    dh.generateMemberNode("osmrel_1_", 18446744073709551615U, &node);
+    ASSERT_EQ(
+        "<https://osm2rdf.cs.uni-freiburg.de/rdf/member#"
+        "osmrel_1_18446744073709551615>",
+        node);
+  }
+}
+
 // ____________________________________________________________________________
 TEST(OSM_FactHandler, writeTagList) {
   // Capture std::cout
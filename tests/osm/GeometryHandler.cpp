@@ -0,0 +1,387 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "osm2rdf/osm/GeometryHandler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+#include "osm2rdf/config/Config.h"
+#include "osm2rdf/ttl/Writer.h"
+#include "osm2rdf/util/AuxGeoCache.h"
+#include "osm2rdf/util/Output.h"
+#include "osmium/builder/attr.hpp"
+#include "osmium/builder/osm_object_builder.hpp"
+#include "osmium/osm/node_ref.hpp"
+
+namespace osm2rdf::osm {
+
+// ____________________________________________________________________________
+osm2rdf::config::Config testConfig() {
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+                          // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+  return config;
+}
+
+// ____________________________________________________________________________
+typedef GeometryHandler<osm2rdf::ttl::format::QLEVER> TestGeometryHandler;
+
+// ____________________________________________________________________________
+void addArea(TestGeometryHandler* gh, uint64_t wayId, double minLon,
+             double minLat, double maxLon, double maxLat) {
+  osmium::memory::Buffer osmiumBuffer{10000,
+                                      osmium::memory::Buffer::auto_grow::yes};
+  osmium::builder::add_area(osmiumBuffer,
+                            osmium::builder::attr::_id(2 * wayId),
+                            osmium::builder::attr::_outer_ring({
+                                {1, {minLon, minLat}},
+                                {2, {maxLon, minLat}},
+                                {3, {maxLon, maxLat}},
+                                {4, {minLon, maxLat}},
+                                {1, {minLon, minLat}},
+                            }));
+  gh->area(osmiumBuffer.get<osmium::Area>(0));
+}
+
+// ____________________________________________________________________________
+void addStar(TestGeometryHandler* gh, uint64_t wayId, double lon, double lat,
+             double radius, size_t numPoints) {
+  // star shaped ring with alternating inner and outer radius, so the
+  // simplified inner and outer geometries differ from the exact one
+  std::vector<osmium::NodeRef> ring;
+  for (size_t i = 0; i < numPoints; i++) {
+    const double r = i % 2 == 0 ? radius : radius * 0.9;
+    const double a = 2 * M_PI * i / numPoints;
+    ring.emplace_back(i + 1,
+                      osmium::Location{lon + r * cos(a), lat + r * sin(a)});
+  }
+  ring.push_back(ring.front());
+  osmium::memory::Buffer osmiumBuffer{10000,
+                                      osmium::memory::Buffer::auto_grow::yes};
+  osmium::builder::add_area(osmiumBuffer,
+                            osmium::builder::attr::_id(2 * wayId),
+                            osmium::builder::attr::_outer_ring(ring));
+  gh->area(osmiumBuffer.get<osmium::Area>(0));
+}
+
+// ____________________________________________________________________________
+std::vector<std::string> calculateRelations(
+    const osm2rdf::config::Config& config,
+    const std::function<void(TestGeometryHandler*)>& addGeometries) {
+  // Capture std::cerr and std::cout
+  std::stringstream cerrBuffer;
+  std::stringstream coutBuffer;
+  std::streambuf* cerrBufferOrig = std::cerr.rdbuf();
+  std::streambuf* coutBufferOrig = std::cout.rdbuf();
+  std::cerr.rdbuf(cerrBuffer.rdbuf());
+  std::cout.rdbuf(coutBuffer.rdbuf());
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER> writer{config, &output};
+  TestGeometryHandler gh{config, &writer};
+  addGeometries(&gh);
+  gh.calculateRelations();
+  output.flush();
+  output.close();
+
+  // Reset std::cerr and std::cout
+  std::cerr.rdbuf(cerrBufferOrig);
+  std::cout.rdbuf(coutBufferOrig);
+
+  // Sorted relation triples
+  std::vector<std::string> res;
+  std::string line;
+  while (std::getline(coutBuffer, line)) {
+    if (line.find(" ogc:") != std::string::npos) res.push_back(line);
+  }
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+// ____________________________________________________________________________
+TEST(OSM_GeometryHandler, spatialStripesWriteRelationsOnce) {
+  const auto addGeometries = [](TestGeometryHandler* gh) {
+    // crossing the border between both stripes at longitude 0
+    addArea(gh, 10, -1.0, 0.0, 1.0, 1.0);
+    addArea(gh, 11, -0.5, 0.1, 0.5, 0.5);
+    // only in the left stripe
+    addArea(gh, 12, -0.3, 0.2, -0.1, 0.3);
+    // only in the right stripe
+    addArea(gh, 13, 0.1, 0.2, 0.3, 0.3);
+  };
+
+  const auto expected = calculateRelations(testConfig(), addGeometries);
+  ASSERT_THAT(expected,
+              ::testing::Contains("osmway:10 ogc:sfContains osmway:11 ."));
+  ASSERT_THAT(expected,
+              ::testing::Contains("osmway:10 ogc:sfContains osmway:12 ."));
+  ASSERT_THAT(expected,
+              ::testing::Contains("osmway:11 ogc:sfContains osmway:13 ."));
+
+  auto config = testConfig();
+  config.numSpatialStripes = 2;
+  std::vector<std::string> res;
+  for (size_t stripe = 0; stripe < config.numSpatialStripes; stripe++) {
+    config.spatialStripe = stripe;
+    const auto stripeRes = calculateRelations(config, addGeometries);
+    // the relations between 10 and 11 belong to the left stripe
+    if (stripe == 1) {
+      ASSERT_THAT(stripeRes, ::testing::Not(::testing::Contains(
+                                 "osmway:10 ogc:sfContains osmway:11 .")));
+    }
+    res.insert(res.end(), stripeRes.begin(), stripeRes.end());
+  }
+  std::sort(res.begin(), res.end());
+
+  // every relation is written by exactly one stripe
+  ASSERT_EQ(expected, res);
+}
+
+// ____________________________________________________________________________
+TEST(OSM_GeometryHandler, reduceContainsChain) {
+  const auto addGeometries = [](TestGeometryHandler* gh) {
+    addArea(gh, 10, 0.0, 0.0, 1.0, 1.0);
+    addArea(gh, 11, 0.1, 0.1, 0.9, 0.9);
+    addArea(gh, 12, 0.2, 0.2, 0.8, 0.8);
+  };
+  const std::string ab = "osmway:10 ogc:sfContains osmway:11 .";
+  const std::string bc = "osmway:11 ogc:sfContains osmway:12 .";
+  const std::string ac = "osmway:10 ogc:sfContains osmway:12 .";
+
+  auto config = testConfig();
+  const auto full = calculateRelations(config, addGeometries);
+  ASSERT_EQ(1, std::count(full.begin(), full.end(), ac));
+
+  config.reduceContains = true;
+  const auto res = calculateRelations(config, addGeometries);
+  ASSERT_EQ(1, std::count(res.begin(), res.end(), ab));
+  ASSERT_EQ(1, std::count(res.begin(), res.end(), bc));
+  // implied by the other two
+  ASSERT_EQ(0, std::count(res.begin(), res.end(), ac));
+  // other relations are kept
+  ASSERT_THAT(res, ::testing::Contains(
+                       "osmway:10 ogc:sfIntersects osmway:12 ."));
+}
+
+// ____________________________________________________________________________
+TEST(OSM_GeometryHandler, reduceContainsEqual) {
+  const auto addGeometries = [](TestGeometryHandler* gh) {
+    addArea(gh, 20, 0.0, 0.0, 1.0, 1.0);
+    addArea(gh, 21, 0.0, 0.0, 1.0, 1.0);
+    addArea(gh, 22, 0.2, 0.2, 0.8, 0.8);
+  };
+  const std::string de = "osmway:20 ogc:sfContains osmway:21 .";
+  const std::string ed = "osmway:21 ogc:sfContains osmway:20 .";
+  const std::string df = "osmway:20 ogc:sfContains osmway:22 .";
+  const std::string ef = "osmway:21 ogc:sfContains osmway:22 .";
+
+  auto config = testConfig();
+  const auto full = calculateRelations(config, addGeometries);
+  ASSERT_EQ(1, std::count(full.begin(), full.end(), df));
+  ASSERT_EQ(1, std::count(full.begin(), full.end(), ef));
+
+  config.reduceContains = true;
+  const auto res = calculateRelations(config, addGeometries);
+  // both directions between the equal geometries are kept, once
+  ASSERT_EQ(std::count(full.begin(), full.end(), de),
+            std::count(res.begin(), res.end(), de));
+  ASSERT_EQ(std::count(full.begin(), full.end(), ed),
+            std::count(res.begin(), res.end(), ed));
+  ASSERT_EQ(1, std::count(res.begin(), res.end(), ed));
+  // the contained geometry is reached exactly once, 20 -> 21 -> 22
+  ASSERT_EQ(0, std::count(res.begin(), res.end(), df));
+  ASSERT_EQ(1, std::count(res.begin(), res.end(), ef));
+  // no triple is written twice
+  ASSERT_EQ(res.end(), std::adjacent_find(res.begin(), res.end()));
+}
+
+// ____________________________________________________________________________
+TEST(OSM_GeometryHandler, simplifyGeometriesSameRelations) {
+  const auto addGeometries = [](TestGeometryHandler* gh) {
+    addStar(gh, 30, 0.0, 0.0, 1.0, 2000);
+    // inside the inner radius
+    addArea(gh, 31, -0.2, -0.2, 0.2, 0.2);
+    // between inner and outer radius, crossing the ring
+    addArea(gh, 32, 0.88, -0.01, 0.99, 0.01);
+    // in the bounding box, but outside of the ring
+    addArea(gh, 33, 0.8, 0.8, 0.9, 0.9);
+    // crossing the ring
+    addArea(gh, 34, 0.5, -0.1, 1.5, 0.1);
+    addStar(gh, 35, 0.05, 0.0, 0.5, 1000);
+  };
+
+  auto config = testConfig();
+  const auto expected = calculateRelations(config, addGeometries);
+  ASSERT_THAT(expected,
+              ::testing::Contains("osmway:30 ogc:sfContains osmway:31 ."));
+  ASSERT_THAT(expected,
+              ::testing::Contains("osmway:30 ogc:sfContains osmway:35 ."));
+  ASSERT_THAT(expected, ::testing::Not(::testing::Contains(
+                            "osmway:30 ogc:sfIntersects osmway:33 .")));
+
+  config.simplifyGeometries = true;
+  ASSERT_EQ(expected, calculateRelations(config, addGeometries));
+}
+
+// ____________________________________________________________________________
+TEST(OSM_GeometryHandler, auxGeoFilesMissingId) {
+  // Capture std::cerr and std::cout
+  std::stringstream cerrBuffer;
+  std::stringstream coutBuffer;
+  std::streambuf* cerrBufferOrig = std::cerr.rdbuf();
+  std::streambuf* coutBufferOrig = std::cout.rdbuf();
+  std::cerr.rdbuf(cerrBuffer.rdbuf());
+  std::cout.rdbuf(coutBuffer.rdbuf());
+
+  auto config = testConfig();
+  const auto auxFile =
+      config.getTempPath("TEST_OSM_GeometryHandler", "auxMissingId.wkt");
+  {
+    std::ofstream out{auxFile};
+    out << "a\tPOINT(1 2)\n";
+    out << "\n";
+    out << "POINT(3 4)\n";
+  }
+  config.auxGeoFiles = {auxFile.string()};
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER> writer{config, &output};
+  GeometryHandler<osm2rdf::ttl::format::QLEVER> gh{config, &writer};
+
+  try {
+    gh.calculateRelations();
+    FAIL() << "Expected std::runtime_error";
+  } catch (const std::runtime_error& e) {
+    ASSERT_THAT(e.what(), ::testing::HasSubstr("Line 3 of auxiliary geo file"));
+  }
+
+  output.flush();
+  output.close();
+
+  // Reset std::cerr and std::cout
+  std::cerr.rdbuf(cerrBufferOrig);
+  std::cout.rdbuf(coutBufferOrig);
+  std::filesystem::remove(auxFile);
+}
+
+// ____________________________________________________________________________
+TEST(OSM_GeometryHandler, auxGeoFilesCache) {
+  // Capture std::cerr and std::cout
+  std::stringstream cerrBuffer;
+  std::stringstream coutBuffer;
+  std::streambuf* cerrBufferOrig = std::cerr.rdbuf();
+  std::streambuf* coutBufferOrig = std::cout.rdbuf();
+  std::cerr.rdbuf(cerrBuffer.rdbuf());
+  std::cout.rdbuf(coutBuffer.rdbuf());
+
+  auto config = testConfig();
+  const auto auxDir = config.getTempPath("TEST_OSM_GeometryHandler", "aux");
+  std::filesystem::remove_all(auxDir);
+  std::filesystem::create_directories(auxDir);
+  const auto auxFile = auxDir / "geo.wkt";
+  {
+    std::ofstream out{auxFile};
+    out << "a\tPOINT(50 50)\n";
+  }
+  config.auxGeoFiles = {auxFile.string()};
+  config.auxGeoFilesCache = true;
+  const auto cacheFile =
+      osm2rdf::util::AuxGeoCache::cachePath(config.cache, auxFile);
+  std::filesystem::remove(cacheFile);
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER> writer{config, &output};
+  GeometryHandler<osm2rdf::ttl::format::QLEVER> gh{config, &writer};
+  gh.calculateRelations();
+  output.flush();
+  output.close();
+
+  // The cache is written to the cache directory, not next to the input
+  ASSERT_TRUE(osm2rdf::util::AuxGeoCache::isCacheFile(cacheFile));
+  ASSERT_EQ(1, std::distance(std::filesystem::directory_iterator(auxDir),
+                             std::filesystem::directory_iterator()));
+
+  // Reset std::cerr and std::cout
+  std::cerr.rdbuf(cerrBufferOrig);
+  std::cout.rdbuf(coutBufferOrig);
+  std::filesystem::remove_all(auxDir);
+  std::filesystem::remove(cacheFile);
+}
+
+// ____________________________________________________________________________
+TEST(OSM_GeometryHandler, auxGeoFilesCacheFallback) {
+  // Capture std::cerr and std::cout
+  std::stringstream cerrBuffer;
+  std::stringstream coutBuffer;
+  std::streambuf* cerrBufferOrig = std::cerr.rdbuf();
+  std::streambuf* coutBufferOrig = std::cout.rdbuf();
+  std::cerr.rdbuf(cerrBuffer.rdbuf());
+  std::cout.rdbuf(coutBuffer.rdbuf());
+
+  auto config = testConfig();
+  const auto auxFile =
+      config.getTempPath("TEST_OSM_GeometryHandler", "auxFallback.wkt");
+  const auto cacheFile =
+      osm2rdf::util::AuxGeoCache::cachePath(config.cache, auxFile);
+  {
+    std::ofstream out{auxFile};
+    // disjoint, no relations are written
+    out << "a\tPOINT(50 50)\n";
+    out << "b\tMULTILINESTRING((1 2, 3 4), (5 6, 7 8))\n";
+  }
+  config.auxGeoFiles = {auxFile.string()};
+  config.auxGeoFilesCache = true;
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::QLEVER> writer{config, &output};
+  GeometryHandler<osm2rdf::ttl::format::QLEVER> gh{config, &writer};
+
+  // Types not supported by the cache are read as WKT instead
+  ASSERT_NO_THROW(gh.calculateRelations());
+  ASSERT_FALSE(std::filesystem::exists(cacheFile));
+  ASSERT_THAT(cerrBuffer.str(),
+              ::testing::HasSubstr("reading it without cache"));
+
+  output.flush();
+  output.close();
+
+  // Reset std::cerr and std::cout
+  std::cerr.rdbuf(cerrBufferOrig);
+  std::cout.rdbuf(coutBufferOrig);
+  std::filesystem::remove(auxFile);
+}
+
+}  // namespace osm2rdf::osm
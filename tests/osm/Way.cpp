@@ -52,6 +52,76 @@ TEST(OSM_Way, FromWay) {
   ASSERT_DOUBLE_EQ(7.51, w.geom().at(0).getY());
   ASSERT_DOUBLE_EQ(48.1, w.geom().at(1).getX());
   ASSERT_DOUBLE_EQ(7.61, w.geom().at(1).getY());
+
+  ASSERT_DOUBLE_EQ(48.0, w.envelope().getLowerLeft().getX());
+  ASSERT_DOUBLE_EQ(7.51, w.envelope().getLowerLeft().getY());
+  ASSERT_DOUBLE_EQ(48.1, w.envelope().getUpperRight().getX());
+  ASSERT_DOUBLE_EQ(7.61, w.envelope().getUpperRight().getY());
+}
+
+// ____________________________________________________________________________
+TEST(OSM_Way, derivedGeometriesAreMemoized) {
+  // Create osmium object
+  const size_t initial_buffer_size = 10000;
+  osmium::memory::Buffer buffer{initial_buffer_size,
+                                osmium::memory::Buffer::auto_grow::yes};
+  osmium::builder::add_way(buffer, osmium::builder::attr::_id(42),
+                           osmium::builder::attr::_nodes({
+                               {1, {48.0, 7.51}},
+                               {2, {48.1, 7.61}},
+                               {3, {48.1, 7.51}},
+                           }));
+
+  // Create osm2rdf object from osmium object
+  const osm2rdf::osm::Way w{buffer.get<osmium::Way>(0)};
+
+  ASSERT_DOUBLE_EQ(::util::geo::latLngLen(w.geom()), w.length());
+  ASSERT_DOUBLE_EQ(::util::geo::centroid(w.geom()).getX(),
+                   w.centroid().getX());
+  ASSERT_DOUBLE_EQ(::util::geo::centroid(w.geom()).getY(),
+                   w.centroid().getY());
+  ASSERT_EQ(::util::geo::convexHull(w.geom()).getOuter().size(),
+            w.convexHull().getOuter().size());
+
+  // Repeated calls return the cached geometry.
+  ASSERT_EQ(&w.centroid(), &w.centroid());
+  ASSERT_EQ(&w.convexHull(), &w.convexHull());
+  ASSERT_EQ(&w.orientedBoundingBox(), &w.orientedBoundingBox());
+}
+
+// ____________________________________________________________________________
+TEST(OSM_Way, resetReusesGeometry) {
+  // Create osmium objects
+  const size_t initial_buffer_size = 10000;
+  osmium::memory::Buffer buffer{initial_buffer_size,
+                                osmium::memory::Buffer::auto_grow::yes};
+  osmium::builder::add_way(buffer, osmium::builder::attr::_id(42),
+                           osmium::builder::attr::_nodes({
+                               {1, {48.0, 7.51}},
+                               {2, {48.1, 7.61}},
+                               {3, {48.1, 7.51}},
+                           }));
+  osmium::builder::add_way(buffer, osmium::builder::attr::_id(43),
+                           osmium::builder::attr::_nodes({
+                               {4, {8.0, 50.0}},
+                               {5, {8.1, 50.1}},
+                           }));
+  auto it = buffer.select<osmium::Way>().begin();
+  const osmium::Way& first = *it;
+  const osmium::Way& second = *(++it);
+
+  osm2rdf::osm::Way w{first};
+  const double firstLength = w.length();
+  const auto* data = w.geom().data();
+
+  w.reset(second);
+  ASSERT_EQ(43, w.id());
+  ASSERT_EQ(data, w.geom().data());
+  ASSERT_EQ(2, w.geom().size());
+  ASSERT_DOUBLE_EQ(8.0, w.geom().at(0).getX());
+  ASSERT_DOUBLE_EQ(50.1, w.envelope().getUpperRight().getY());
+  ASSERT_NE(firstLength, w.length());
+  ASSERT_DOUBLE_EQ(::util::geo::latLngLen(w.geom()), w.length());
 }
 
 // ____________________________________________________________________________
@@ -197,6 +267,7 @@ TEST(OSM_Way, isAreaFalseForOpenWay) {
   ASSERT_FALSE(w.closed());
 
   ASSERT_FALSE(w.isArea());
+  ASSERT_FALSE(osm2rdf::osm::Way::isArea(buffer.get<osmium::Way>(0)));
 }
 
 // ____________________________________________________________________________
@@ -218,6 +289,7 @@ TEST(OSM_Way, isAreaFalseForTriangleWithoutTags) {
   ASSERT_TRUE(w.closed());
 
   ASSERT_FALSE(w.isArea());
+  ASSERT_FALSE(osm2rdf::osm::Way::isArea(buffer.get<osmium::Way>(0)));
 }
 
 // ____________________________________________________________________________
@@ -240,6 +312,7 @@ TEST(OSM_Way, isAreaFTrueForTriangleWithTags) {
   ASSERT_TRUE(w.closed());
 
   ASSERT_TRUE(w.isArea());
+  ASSERT_TRUE(osm2rdf::osm::Way::isArea(buffer.get<osmium::Way>(0)));
 }
 
 // ____________________________________________________________________________
@@ -262,6 +335,7 @@ TEST(OSM_Way, isAreaFalseForTriangleMarkedAsNoArea) {
   ASSERT_TRUE(w.closed());
 
   ASSERT_FALSE(w.isArea());
+  ASSERT_FALSE(osm2rdf::osm::Way::isArea(buffer.get<osmium::Way>(0)));
 }
 
 }  // namespace osm2rdf::osm
@@ -0,0 +1,305 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "osm2rdf/ttl/BinaryReader.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "osm2rdf/config/Config.h"
+#include "osm2rdf/ttl/Constants.h"
+#include "osm2rdf/util/Output.h"
+
+namespace osm2rdf::ttl {
+
+// ____________________________________________________________________________
+osm2rdf::config::Config testConfig() {
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+  // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+  return config;
+}
+
+// ____________________________________________________________________________
+template <typename T>
+std::string writeTriples() {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  const auto config = testConfig();
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  Writer<T> w{config, &output};
+  w.writeHeader();
+
+  const auto s = w.generateIRI(constants::NAMESPACE__OSM_WAY, 42);
+  const auto p = w.generateIRI(constants::NAMESPACE__RDF, "type");
+  w.writeTriple(s, p, w.generateIRI(constants::NAMESPACE__OSM_NODE, 7));
+  w.writeIRITriple(s, p, w.prefixId(constants::NAMESPACE__OSM_WAY), 1);
+  w.writeIRITriple(s, p, "https://example.org/", 42);
+  w.writeLiteralTriple(s, p, "a\"b\\c\nd");
+  w.writeTriple(s, p, w.generateLiteral("a\"b"));
+  w.writeTriple(s, p, w.generateLiteral("Freiburg", "@de"));
+  w.writeIntegerLiteralTriple(s, p, -9223372036854775807 - 1);
+  w.writeLiteralTripleUnsafe(s, p, "2020", "^^" + constants::IRI__XSD__YEAR);
+  w.writeIRITripleUnsafe(
+      s, p, w.prefixId(constants::NAMESPACE__WIKIDATA_ENTITY), "Q42");
+  w.writeIRIREFTriple(s, p, {"https://", "de", ".wikipedia.org/wiki/", "A B"});
+  w.writeTriple(s, p, w.newBlankNode());
+  w.writeTripleStart(w.generateIRI(constants::NAMESPACE__OSM_WAY, "007"), p);
+  w.write("\"POINT(1 2)\"^^");
+  w.write(constants::IRI__GEOSPARQL__WKT_LITERAL);
+  w.writeTripleEnd();
+  w.writeSecondsAsISO(s, p, 0);
+  w.writeTriple(s, w.generateIRI(constants::NAMESPACE__OSM_TAG, "addr:city"),
+                w.generateLiteral("Freiburg", ""));
+  w.writeTriple(
+      w.generateIRI(w.prefixId(constants::NAMESPACE__OSM_WAY), 43), p,
+      w.generateIRIUnsafe(w.prefixId(constants::NAMESPACE__OSM2RDF_GEOM),
+                          "osmway_", 43));
+  w.writeTripleStart(s, p);
+  w.writeLiteralStart();
+  w.write("POINT(3 4)");
+  w.writeLiteralEnd(w.prefixId(constants::NAMESPACE__GEOSPARQL), "wktLiteral");
+  w.writeTripleEnd();
+
+  output.flush();
+  output.close();
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+  return buffer.str();
+}
+
+// ____________________________________________________________________________
+TEST(TTL_BinaryReader, varint) {
+  char buf[binary::MAX_VARINT_LENGTH];
+  ASSERT_EQ(1, binary::encodeVarint(0, buf));
+  ASSERT_EQ(0, buf[0]);
+  ASSERT_EQ(2, binary::encodeVarint(300, buf));
+  ASSERT_EQ(static_cast<char>(0xAC), buf[0]);
+  ASSERT_EQ(0x02, buf[1]);
+  ASSERT_EQ(binary::MAX_VARINT_LENGTH,
+            binary::encodeVarint(18446744073709551615U, buf));
+
+  ASSERT_EQ(0, binary::encodeZigZag(0));
+  ASSERT_EQ(1, binary::encodeZigZag(-1));
+  ASSERT_EQ(2, binary::encodeZigZag(1));
+  for (const int64_t v : {int64_t{0}, int64_t{-1}, int64_t{42},
+                          int64_t{-9223372036854775807 - 1},
+                          int64_t{9223372036854775807}}) {
+    ASSERT_EQ(v, binary::decodeZigZag(binary::encodeZigZag(v)));
+  }
+}
+
+// ____________________________________________________________________________
+TEST(TTL_BinaryReader, terms) {
+  std::stringstream in{writeTriples<format::BINARY>()};
+  BinaryReader reader{&in};
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::PREFIXED_ID, reader.term(0).type);
+  ASSERT_EQ("https://www.openstreetmap.org/way/", reader.term(0).prefix);
+  ASSERT_EQ(42, reader.term(0).id);
+  ASSERT_EQ(binary::Term::PREFIXED, reader.term(1).type);
+  ASSERT_EQ("type", reader.term(1).value);
+  ASSERT_EQ(binary::Term::PREFIXED_ID, reader.term(2).type);
+  ASSERT_EQ("https://www.openstreetmap.org/node/", reader.term(2).prefix);
+  ASSERT_EQ(7, reader.term(2).id);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::PREFIXED_ID, reader.term(2).type);
+  ASSERT_EQ(1, reader.term(2).id);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::IRI, reader.term(2).type);
+  ASSERT_EQ("https://example.org/42", reader.term(2).value);
+
+  // Literals are not escaped
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::LITERAL, reader.term(2).type);
+  ASSERT_EQ("a\"b\\c\nd", reader.term(2).value);
+
+  // Already escaped terms are unescaped
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::LITERAL, reader.term(2).type);
+  ASSERT_EQ("a\"b", reader.term(2).value);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::LANG_LITERAL, reader.term(2).type);
+  ASSERT_EQ("Freiburg", reader.term(2).value);
+  ASSERT_EQ("de", reader.term(2).lang);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::INTEGER, reader.term(2).type);
+  ASSERT_EQ(-9223372036854775807 - 1, reader.term(2).integer);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::TYPED_LITERAL, reader.term(2).type);
+  ASSERT_EQ("2020", reader.term(2).value);
+  ASSERT_EQ("http://www.w3.org/2001/XMLSchema#gYear", reader.term(2).datatype);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::PREFIXED, reader.term(2).type);
+  ASSERT_EQ("http://www.wikidata.org/entity/", reader.term(2).prefix);
+  ASSERT_EQ("Q42", reader.term(2).value);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::IRI, reader.term(2).type);
+  ASSERT_EQ("https://de.wikipedia.org/wiki/A B", reader.term(2).value);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::BLANK_NODE, reader.term(2).type);
+  ASSERT_EQ("0_0", reader.term(2).value);
+
+  // Only canonical decimals are ids
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::PREFIXED, reader.term(0).type);
+  ASSERT_EQ("007", reader.term(0).value);
+  ASSERT_EQ(binary::Term::TYPED_LITERAL, reader.term(2).type);
+  ASSERT_EQ("POINT(1 2)", reader.term(2).value);
+  ASSERT_EQ("http://www.opengis.net/ont/geosparql#wktLiteral",
+            reader.term(2).datatype);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::TYPED_LITERAL, reader.term(2).type);
+  ASSERT_EQ("http://www.w3.org/2001/XMLSchema#dateTime",
+            reader.term(2).datatype);
+
+  // Prefixes not ending in '/' or '#' are found as well
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::PREFIXED, reader.term(1).type);
+  ASSERT_EQ("https://www.openstreetmap.org/wiki/Key:", reader.term(1).prefix);
+  ASSERT_EQ("addr:city", reader.term(1).value);
+  ASSERT_EQ(binary::Term::LITERAL, reader.term(2).type);
+
+  // Terms generated from a prefix id are encoded directly
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::PREFIXED_ID, reader.term(0).type);
+  ASSERT_EQ(43, reader.term(0).id);
+  ASSERT_EQ(binary::Term::PREFIXED, reader.term(2).type);
+  ASSERT_EQ("https://osm2rdf.cs.uni-freiburg.de/rdf/geom#",
+            reader.term(2).prefix);
+  ASSERT_EQ("osmway_43", reader.term(2).value);
+
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::TYPED_LITERAL, reader.term(2).type);
+  ASSERT_EQ("POINT(3 4)", reader.term(2).value);
+  ASSERT_EQ("http://www.opengis.net/ont/geosparql#wktLiteral",
+            reader.term(2).datatype);
+
+  ASSERT_FALSE(reader.next());
+}
+
+// ____________________________________________________________________________
+TEST(TTL_BinaryReader, unescape) {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  const auto config = testConfig();
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  Writer<format::BINARY> w{config, &output};
+  w.writeHeader();
+  const auto s = w.generateIRI(constants::NAMESPACE__OSM_WAY, 42);
+  w.writeTriple(s, "<https://example.org/\\u00E4>",
+                "\"\\u00e4\\U0001F600\\t\\\\\"@de");
+  w.writeTriple(s, s, "\"a\\qb\"");
+  output.flush();
+  output.close();
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+
+  BinaryReader reader{&buffer};
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::IRI, reader.term(1).type);
+  ASSERT_EQ("https://example.org/\xC3\xA4", reader.term(1).value);
+  ASSERT_EQ(binary::Term::LANG_LITERAL, reader.term(2).type);
+  ASSERT_EQ("\xC3\xA4\xF0\x9F\x98\x80\t\\", reader.term(2).value);
+  ASSERT_EQ("de", reader.term(2).lang);
+
+  // Invalid escape sequences are kept as NT
+  ASSERT_TRUE(reader.next());
+  ASSERT_EQ(binary::Term::NT, reader.term(2).type);
+  ASSERT_EQ("\"a\\qb\"", reader.term(2).value);
+
+  ASSERT_FALSE(reader.next());
+}
+
+// ____________________________________________________________________________
+TEST(TTL_BinaryReader, convert) {
+  const std::string nt = writeTriples<format::NT>();
+  // Concatenated streams are read one after the other
+  std::stringstream in{writeTriples<format::BINARY>() +
+                       writeTriples<format::BINARY>()};
+
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  const auto config = testConfig();
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  Writer<format::NT> writer{config, &output};
+  const size_t count = BinaryReader::convert(&in, &writer);
+  output.flush();
+  output.close();
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+
+  ASSERT_EQ(32, count);
+  ASSERT_EQ(nt + nt, buffer.str());
+}
+
+// ____________________________________________________________________________
+TEST(TTL_BinaryReader, invalid) {
+  const std::string binary = writeTriples<format::BINARY>();
+  {
+    // Missing header
+    std::stringstream in{binary.substr(binary::MAGIC.size())};
+    BinaryReader reader{&in};
+    ASSERT_THROW(reader.next(), std::runtime_error);
+  }
+  {
+    // Truncated triple
+    std::stringstream in{binary.substr(0, binary.size() - 3)};
+    BinaryReader reader{&in};
+    ASSERT_THROW(
+        while (reader.next()) {}, std::runtime_error);
+  }
+  {
+    std::stringstream in{std::string{"\x07"}};
+    BinaryReader reader{&in};
+    ASSERT_THROW(reader.next(), std::runtime_error);
+  }
+}
+
+}  // namespace osm2rdf::ttl
@@ -117,6 +117,20 @@ TEST(TTL_WriterQLEVER, addPrefix) {
   }
 }
 
+// ____________________________________________________________________________
+TEST(TTL_Writer, prefixId) {
+  osm2rdf::config::Config config;
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT> w{config, nullptr};
+  ASSERT_THROW(w.prefixId("test"), std::out_of_range);
+  ASSERT_TRUE(w.addPrefix("test", "prefix"));
+  const auto id = w.prefixId("test");
+  ASSERT_FALSE(w.addPrefix("test", "other"));
+  ASSERT_EQ(id, w.prefixId("test"));
+  ASSERT_STREQ("prefix", w.resolvePrefix("test").c_str());
+  ASSERT_NE(w.prefixId(osm2rdf::ttl::constants::NAMESPACE__OSM_WAY),
+            w.prefixId(osm2rdf::ttl::constants::NAMESPACE__OSM_NODE));
+}
+
 // ____________________________________________________________________________
 TEST(TTL_WriterNT, writeHeader) {
   // Capture std::cout
@@ -252,6 +266,21 @@ TEST(TTL_WriterQLEVER, generateBlankNode) {
   }
 }
 
+// ____________________________________________________________________________
+TEST(TTL_WriterTTL, newBlankNode) {
+  osm2rdf::config::Config config;
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL> w{config, nullptr};
+  const osm2rdf::ttl::BlankNode node = w.newBlankNode();
+  ASSERT_EQ("_:0_0", std::string_view(node));
+  ASSERT_EQ("_:0_1", w.generateBlankNode());
+  ASSERT_EQ("_:0_2", std::string_view(w.newBlankNode()));
+
+  ASSERT_EQ("", std::string_view(osm2rdf::ttl::BlankNode{}));
+  ASSERT_EQ("_:18446744073709551615_18446744073709551615",
+            std::string_view(osm2rdf::ttl::BlankNode{
+                18446744073709551615U, 18446744073709551615U}));
+}
+
 // ____________________________________________________________________________
 TEST(TTL_WriterNT, generateIRI_ID) {
   osm2rdf::config::Config config;
@@ -808,4 +837,197 @@ TEST(TTL_Writer, writeSecondsAsISO) {
   std::cout.rdbuf(sbuf);
 }
 
+// ____________________________________________________________________________
+TEST(TTL_WriterNT, writeStreamingTriples) {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+  // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT> writer{config, &output};
+
+  writer.writeIRITriple("s", "p", "osmway", 18446744073709551615U);
+  writer.writeIRITriple("s", "p", writer.prefixId("osmway"), 1);
+  writer.writeIRITriple("s", "p", "https://example.org/", 42);
+  writer.writeLiteralTriple("s", "p", "a\"b\\c\nd");
+  writer.writeIntegerLiteralTriple("s", "p", -9223372036854775807 - 1);
+  writer.writeIntegerLiteralTriple("s", "p", 0);
+  writer.writeTripleStart("s", "p");
+  writer.writeIntegerLiteral(7, 0);
+  writer.writeTripleEnd();
+  writer.writeIRITripleUnsafe("s", "p", writer.prefixId("wd"), "Q42");
+  writer.writeIRIREFTriple("s", "p",
+                           {"https://", "de", ".wikipedia.org/wiki/", "A B"});
+  output.flush();
+  output.close();
+
+  const std::string printedData = buffer.str();
+  ASSERT_EQ(
+      "s p <https://www.openstreetmap.org/way/18446744073709551615> .\n"
+      "s p <https://www.openstreetmap.org/way/1> .\n"
+      "s p <https://example.org/42> .\n"
+      "s p \"a\\\"b\\\\c\\nd\" .\n"
+      "s p \"-9223372036854775808\"^^"
+      "<http://www.w3.org/2001/XMLSchema#integer> .\n"
+      "s p \"0\"^^<http://www.w3.org/2001/XMLSchema#integer> .\n"
+      "s p \"7\"^^<http://www.w3.org/2001/XMLSchema#integer> .\n"
+      "s p <http://www.wikidata.org/entity/Q42> .\n"
+      "s p <https://de.wikipedia.org/wiki/A\\u0020B> .\n",
+      printedData);
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+}
+
+// ____________________________________________________________________________
+TEST(TTL_WriterTTL, writeStreamingTriples) {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+  // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL> writer{config, &output};
+
+  writer.writeIRITriple("s", "p", "osmway", 18446744073709551615U);
+  writer.writeIRITriple("s", "p", writer.prefixId("osmway"), 1);
+  writer.writeIRITriple("s", "p", "https://example.org/", 42);
+  writer.writeLiteralTriple("s", "p", "a\"b\\c\nd");
+  writer.writeIntegerLiteralTriple("s", "p", -9223372036854775807 - 1);
+  writer.writeIntegerLiteralTriple("s", "p", 0);
+  writer.writeTripleStart("s", "p");
+  writer.writeIntegerLiteral(7, 0);
+  writer.writeTripleEnd();
+  writer.writeIRITripleUnsafe("s", "p", writer.prefixId("wd"), "Q42");
+  writer.writeIRIREFTriple("s", "p",
+                           {"https://", "de", ".wikipedia.org/wiki/", "A B"});
+  output.flush();
+  output.close();
+
+  const std::string printedData = buffer.str();
+  ASSERT_EQ(
+      "s p osmway:18446744073709551615 .\n"
+      "s p osmway:1 .\n"
+      "s p <https://example.org/42> .\n"
+      "s p \"a\\\"b\\\\c\\nd\" .\n"
+      "s p \"-9223372036854775808\"^^xsd:integer .\n"
+      "s p \"0\"^^xsd:integer .\n"
+      "s p \"7\"^^xsd:integer .\n"
+      "s p wd:Q42 .\n"
+      "s p <https://de.wikipedia.org/wiki/A\\u0020B> .\n",
+      printedData);
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+}
+
+// ____________________________________________________________________________
+TEST(TTL_WriterNT, writeGroupedTriples) {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+  // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+  config.outputGroupSubjects = true;
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::NT> writer{config, &output};
+
+  // NT is always line based
+  writer.writeTriple("s", "p", "o");
+  writer.writeLiteralTriple("s", "p", "a");
+  writer.closeStatements();
+  output.flush();
+  output.close();
+
+  ASSERT_EQ("s p o .\ns p \"a\" .\n", buffer.str());
+
+  // Cleanup
+  std::cout.rdbuf(sbuf);
+}
+
+// ____________________________________________________________________________
+TEST(TTL_WriterTTL, writeGroupedTriples) {
+  // Capture std::cout
+  std::stringstream buffer;
+  std::streambuf* sbuf = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+
+  osm2rdf::config::Config config;
+  config.output = "";
+  config.numThreads = 1;  // set to one to avoid concurrency issues with the
+  // stringstream read buffer
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = osm2rdf::util::OutputMergeMode::NONE;
+  config.outputGroupSubjects = true;
+
+  osm2rdf::util::Output output{config, config.output};
+  output.open();
+  osm2rdf::ttl::Writer<osm2rdf::ttl::format::TTL> writer{config, &output};
+
+  // Setup temp dir and stats file
+  std::filesystem::path tmpDir =
+      config.getTempPath("TEST_TTL_WriterTTL", "writeGroupedTriples");
+  std::filesystem::create_directories(tmpDir);
+  std::filesystem::path statsFile{tmpDir};
+  statsFile /= "file";
+
+  writer.writeTriple("s", "p", "o");
+  writer.writeIRITriple("s", "q", writer.prefixId("osmway"), 1);
+  writer.writeTripleStart("s", "p");
+  writer.writeIntegerLiteral(7, 0);
+  writer.writeTripleEnd();
+  writer.writeLiteralTriple("t", "p", "a");
+  writer.writeTriple("s", "p", "o");
+  writer.closeStatements();
+  // Nothing left to close
+  writer.closeStatements();
+  writer.writeStatisticJson(statsFile);
+  output.flush();
+  output.close();
+
+  ASSERT_EQ(
+      "s p o ;\n"
+      "\tq osmway:1 ;\n"
+      "\tp \"7\"^^xsd:integer .\n"
+      "t p \"a\" .\n"
+      "s p o .\n",
+      buffer.str());
+
+  std::ifstream statsIFStream(statsFile);
+  std::stringstream statsBuffer;
+  statsBuffer << statsIFStream.rdbuf();
+  ASSERT_THAT(statsBuffer.str(), ::testing::HasSubstr("\"lines\": 5"));
+  ASSERT_THAT(statsBuffer.str(), ::testing::HasSubstr("\"triples\": 5"));
+
+  // Cleanup
+  statsIFStream.close();
+  std::cout.rdbuf(sbuf);
+  std::filesystem::remove_all(tmpDir);
+}
+
 }  // namespace osm2rdf::ttl
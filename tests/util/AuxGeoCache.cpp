@@ -0,0 +1,245 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "osm2rdf/util/AuxGeoCache.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+namespace osm2rdf::util {
+
+// ____________________________________________________________________________
+::util::geo::I32Point identity(const ::util::geo::DPoint& p) {
+  return {static_cast<int32_t>(p.getX()), static_cast<int32_t>(p.getY())};
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_AuxGeoCache, writeAndRead) {
+  const std::filesystem::path path = "/tmp/TEST_UTIL_AuxGeoCache_writeAndRead";
+  {
+    AuxGeoCache::Writer w{path};
+    w.add("a", ::util::geo::I32Point{1, 2});
+    w.add("bb", ::util::geo::I32Line{{1, 2}, {3, 4}, {5, 6}});
+    ::util::geo::I32MultiPolygon mp(2);
+    mp[0].getOuter() = {{0, 0}, {10, 0}, {10, 10}, {0, 0}};
+    mp[0].getInners().push_back({{1, 1}, {2, 1}, {2, 2}, {1, 1}});
+    mp[1].getOuter() = {{20, 20}, {30, 20}, {30, 30}, {20, 20}};
+    w.add("ccc", mp);
+    w.close();
+  }
+
+  ASSERT_TRUE(AuxGeoCache::isCacheFile(path));
+  AuxGeoCache c{path};
+  ASSERT_EQ(3, c.size());
+
+  ASSERT_EQ(AuxGeoType::POINT, c.type(0));
+  ASSERT_EQ("a", c.id(0));
+  ASSERT_EQ(1, c.point(0).getX());
+  ASSERT_EQ(2, c.point(0).getY());
+
+  ASSERT_EQ(AuxGeoType::LINE, c.type(1));
+  ASSERT_EQ("bb", c.id(1));
+  const auto line = c.line(1);
+  ASSERT_EQ(3, line.size());
+  ASSERT_EQ(5, line[2].getX());
+  ASSERT_EQ(6, line[2].getY());
+
+  ASSERT_EQ(AuxGeoType::MULTIPOLYGON, c.type(2));
+  ASSERT_EQ("ccc", c.id(2));
+  const auto res = c.multiPolygon(2);
+  ASSERT_EQ(2, res.size());
+  ASSERT_EQ(4, res[0].getOuter().size());
+  ASSERT_EQ(1, res[0].getInners().size());
+  ASSERT_EQ(2, res[0].getInners()[0][1].getX());
+  ASSERT_EQ(0, res[1].getInners().size());
+  ASSERT_EQ(30, res[1].getOuter()[2].getY());
+
+  std::filesystem::remove(path);
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_AuxGeoCache, unclosedIsNoCacheFile) {
+  const std::filesystem::path path = "/tmp/TEST_UTIL_AuxGeoCache_unclosed";
+  {
+    AuxGeoCache::Writer w{path};
+    w.add("a", ::util::geo::I32Point{1, 2});
+  }
+  ASSERT_FALSE(AuxGeoCache::isCacheFile(path));
+  ASSERT_THROW(AuxGeoCache{path}, std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_AuxGeoCache, convertWKT) {
+  const std::filesystem::path wkt = "/tmp/TEST_UTIL_AuxGeoCache_convert.wkt";
+  const std::filesystem::path path = "/tmp/TEST_UTIL_AuxGeoCache_convert";
+  {
+    std::ofstream out{wkt};
+    out << "p\tPOINT(1 2)\n";
+    out << "l\tLINESTRING (1 2, 3 4)\n";
+    out << "\n";
+    out << "e\tPOLYGON EMPTY\n";
+    out << "a\tPOLYGON((0 0,10 0,10 10,0 0),(1 1,2 1,2 2,1 1))\n";
+    out << "m\tMULTIPOLYGON(((0 0,1 0,1 1,0 0)),((5 5,6 5,6 6,5 5)))\n";
+  }
+
+  ASSERT_FALSE(AuxGeoCache::isCacheFile(wkt));
+  ASSERT_EQ(4, AuxGeoCache::convert(wkt, path, identity));
+
+  AuxGeoCache c{path};
+  ASSERT_EQ(4, c.size());
+  ASSERT_EQ("p", c.id(0));
+  ASSERT_EQ(AuxGeoType::POINT, c.type(0));
+  ASSERT_EQ(2, c.point(0).getY());
+  ASSERT_EQ("l", c.id(1));
+  ASSERT_EQ(AuxGeoType::LINE, c.type(1));
+  ASSERT_EQ(3, c.line(1)[1].getX());
+  ASSERT_EQ("a", c.id(2));
+  ASSERT_EQ(AuxGeoType::MULTIPOLYGON, c.type(2));
+  ASSERT_EQ(1, c.multiPolygon(2).size());
+  ASSERT_EQ(1, c.multiPolygon(2)[0].getInners().size());
+  ASSERT_EQ("m", c.id(3));
+  ASSERT_EQ(2, c.multiPolygon(3).size());
+  ASSERT_EQ(6, c.multiPolygon(3)[1].getOuter()[2].getY());
+
+  std::filesystem::remove(wkt);
+  std::filesystem::remove(path);
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_AuxGeoCache, convertWKTInvalid) {
+  const std::filesystem::path wkt = "/tmp/TEST_UTIL_AuxGeoCache_invalid.wkt";
+  const std::filesystem::path path = "/tmp/TEST_UTIL_AuxGeoCache_invalid";
+  {
+    std::ofstream out{wkt};
+    out << "p\tPOINT(1 2)\n";
+    out << "x\tLINESTRING(1 2, 3)\n";
+  }
+
+  ASSERT_THROW(AuxGeoCache::convert(wkt, path, identity), std::runtime_error);
+  ASSERT_FALSE(AuxGeoCache::isCacheFile(path));
+
+  std::filesystem::remove(wkt);
+  std::filesystem::remove(path);
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_AuxGeoCache, convertWKTMissingId) {
+  const std::filesystem::path wkt = "/tmp/TEST_UTIL_AuxGeoCache_noid.wkt";
+  const std::filesystem::path path = "/tmp/TEST_UTIL_AuxGeoCache_noid";
+  {
+    std::ofstream out{wkt};
+    out << "p\tPOINT(1 2)\n";
+    out << "POINT(3 4)\n";
+  }
+
+  ASSERT_THROW(AuxGeoCache::convert(wkt, path, identity), std::runtime_error);
+  ASSERT_FALSE(AuxGeoCache::isCacheFile(path));
+
+  std::filesystem::remove(wkt);
+  std::filesystem::remove(path);
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_AuxGeoCache, convertWKTUnsupported) {
+  const std::filesystem::path wkt = "/tmp/TEST_UTIL_AuxGeoCache_multi.wkt";
+  const std::filesystem::path path = "/tmp/TEST_UTIL_AuxGeoCache_multi";
+  for (const auto& geom :
+       {"MULTILINESTRING((1 2, 3 4))", "MULTIPOINT((1 2))",
+        "GEOMETRYCOLLECTION(POINT(1 2))", "POINT(1 2) junk",
+        "LINESTRING(1 2, 3 4),"}) {
+    {
+      std::ofstream out{wkt};
+      out << "p\tPOINT(1 2) \n";
+      out << "x\t" << geom << "\n";
+    }
+    ASSERT_THROW(AuxGeoCache::convert(wkt, path, identity), std::runtime_error)
+        << geom;
+    ASSERT_FALSE(AuxGeoCache::isCacheFile(path));
+  }
+
+  std::filesystem::remove(wkt);
+  std::filesystem::remove(path);
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_AuxGeoCache, corruptRecord) {
+  const std::filesystem::path path = "/tmp/TEST_UTIL_AuxGeoCache_corrupt";
+  {
+    AuxGeoCache::Writer w{path};
+    w.add("a", ::util::geo::I32Line{{1, 2}, {3, 4}});
+    w.close();
+  }
+  ASSERT_EQ(1, AuxGeoCache{path}.size());
+
+  // Number of points of the line, behind the header, type and id
+  {
+    std::fstream f{path, std::ios::in | std::ios::out | std::ios::binary};
+    f.seekp(AuxGeoCache::MAGIC.size() + 2 * sizeof(uint64_t) + 1 +
+            sizeof(uint32_t) + 1);
+    const uint32_t n = 1000000;
+    f.write(reinterpret_cast<const char*>(&n), sizeof(n));
+  }
+  ASSERT_TRUE(AuxGeoCache::isCacheFile(path));
+  ASSERT_THROW(AuxGeoCache{path}, std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_AuxGeoCache, writeIsAtomic) {
+  const std::filesystem::path dir = "/tmp/TEST_UTIL_AuxGeoCache_atomic";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  const auto path = dir / "cache";
+  {
+    AuxGeoCache::Writer w{path};
+    w.add("a", ::util::geo::I32Point{1, 2});
+    // Nothing at the final path before close
+    ASSERT_FALSE(std::filesystem::exists(path));
+    w.close();
+  }
+  ASSERT_TRUE(AuxGeoCache::isCacheFile(path));
+  ASSERT_EQ(1, std::distance(std::filesystem::directory_iterator(dir),
+                             std::filesystem::directory_iterator()));
+  {
+    // An unclosed writer keeps the old cache and leaves no temporary file
+    AuxGeoCache::Writer w{path};
+    w.add("b", ::util::geo::I32Point{1, 2});
+  }
+  ASSERT_EQ("a", AuxGeoCache{path}.id(0));
+  ASSERT_EQ(1, std::distance(std::filesystem::directory_iterator(dir),
+                             std::filesystem::directory_iterator()));
+
+  std::filesystem::remove_all(dir);
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_AuxGeoCache, cachePath) {
+  const auto a = AuxGeoCache::cachePath("/tmp/cache", "/data/a/geo.wkt");
+  const auto b = AuxGeoCache::cachePath("/tmp/cache", "/data/b/geo.wkt");
+  ASSERT_EQ("/tmp/cache", a.parent_path().string());
+  ASSERT_EQ(0, a.filename().string().find("geo.wkt-"));
+  ASSERT_EQ(".o2rgeo", a.extension().string());
+  ASSERT_NE(a, b);
+  ASSERT_EQ(a, AuxGeoCache::cachePath("/tmp/cache", "/data/a/../a/geo.wkt"));
+}
+
+}  // namespace osm2rdf::util
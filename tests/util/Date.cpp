@@ -0,0 +1,72 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "osm2rdf/util/Date.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace osm2rdf::util {
+
+// ____________________________________________________________________________
+std::string normalize(std::string_view v, DateType expected) {
+  char buf[DATE_BUFFER_SIZE];
+  size_t len = 0;
+  EXPECT_EQ(expected, normalizeDate(v, buf, &len)) << v;
+  return {buf, len};
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Date, normalizeDateYear) {
+  ASSERT_EQ("2022", normalize("2022", DateType::YEAR));
+  ASSERT_EQ("0800", normalize("800", DateType::YEAR));
+  ASSERT_EQ("0800", normalize("0800", DateType::YEAR));
+  ASSERT_EQ("0000", normalize("0", DateType::YEAR));
+  ASSERT_EQ("-0010", normalize("-10", DateType::YEAR));
+  ASSERT_EQ("1234", normalize("12345", DateType::YEAR));
+  ASSERT_EQ("1234", normalize("0012345", DateType::YEAR));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Date, normalizeDateYearMonth) {
+  ASSERT_EQ("2022-05", normalize("2022-5", DateType::YEAR_MONTH));
+  ASSERT_EQ("2022-12", normalize("2022-012", DateType::YEAR_MONTH));
+  ASSERT_EQ("-0800-01", normalize("-800-01", DateType::YEAR_MONTH));
+  ASSERT_EQ("-0000-05", normalize("--5", DateType::YEAR_MONTH));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Date, normalizeDateDate) {
+  ASSERT_EQ("2022-05-01", normalize("2022-5-1", DateType::DATE));
+  ASSERT_EQ("2022-12-31", normalize("2022-12-31", DateType::DATE));
+  ASSERT_EQ("-0044-03-15", normalize("-44-3-15", DateType::DATE));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Date, normalizeDateInvalid) {
+  for (const std::string_view v :
+       {"", "-", "--", "2022-", "2022--01", "2022-13", "2022-0", "2022-1-32",
+        "2022-1-0", "2022-01-01-01", "-2022-01-01-01", "2022-1000000000000",
+        "ca. 1900", "1900s", "2022-05-01T00:00", " 2022", "2022/05"}) {
+    normalize(v, DateType::INVALID);
+  }
+}
+
+}  // namespace osm2rdf::util
@@ -18,6 +18,9 @@
 
 #include "osm2rdf/util/DirectedAcyclicGraph.h"
 
+#include <chrono>
+#include <iostream>
+
 #include "gtest/gtest.h"
 #include "osm2rdf/util/DirectedGraph.h"
 
@@ -56,6 +59,7 @@ osm2rdf::util::DirectedGraph<uint8_t> createWhiteboardExample1ExpectedResult() {
   src.addEdge(2, 6);
   src.addEdge(5, 0);
   src.addEdge(5, 2);
+  src.freeze();
   return src;
 }
 
@@ -196,6 +200,7 @@ osm2rdf::util::DirectedGraph<uint8_t> createWhiteboardExample2ExpectedResult() {
   src.addEdge(4, 6);
   src.addEdge(5, 2);
   src.addEdge(5, 3);
+  src.freeze();
   return src;
 }
 
@@ -330,6 +335,7 @@ osm2rdf::util::DirectedGraph<uint8_t> createLineExample1ExpectedResult() {
   src.addEdge(3, 4);
   src.addEdge(4, 5);
   src.addEdge(5, 6);
+  src.freeze();
   return src;
 }
 
@@ -647,4 +653,58 @@ TEST(UTIL_DirectedAcyclicGraph,
   }
 }
 
-}  // namespace osm2rdf::util
\ No newline at end of file
+// ____________________________________________________________________________
+// Synthetic containment hierarchy: vertex i is contained in its parent
+// (i - 1) / FANOUT and, as the graph is transitively closed, in all
+// ancestors. The reduction only keeps the edges to the parents.
+void benchmarkReduce(size_t numEdges) {
+  const size_t FANOUT = 8;
+  osm2rdf::util::DirectedGraph<uint64_t> src{};
+  size_t numVertices = 1;
+  while (src.getNumEdges() < numEdges) {
+    for (uint64_t p = numVertices; p > 0;) {
+      p = (p - 1) / FANOUT;
+      src.addEdge(numVertices, p);
+    }
+    numVertices++;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  src.freeze();
+  std::chrono::duration<double> freezeTime =
+      std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  const auto reduced = osm2rdf::util::reduceDAG(src, false);
+  std::chrono::duration<double> reduceTime =
+      std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  const auto reducedMax = osm2rdf::util::reduceMaximalConnectedDAG(src, false);
+  std::chrono::duration<double> reduceMaxTime =
+      std::chrono::steady_clock::now() - start;
+
+  std::cerr << src.getNumEdges() << " edges, " << numVertices
+            << " vertices\n"
+            << "freeze:                    " << freezeTime.count() << "s\n"
+            << "reduceDAG:                 " << reduceTime.count() << "s\n"
+            << "reduceMaximalConnectedDAG: " << reduceMaxTime.count()
+            << "s\n";
+
+  ASSERT_EQ(numVertices - 1, reduced.getNumEdges());
+  ASSERT_EQ(numVertices - 1, reducedMax.getNumEdges());
+  ASSERT_EQ(std::vector<uint64_t>{0}, reduced.getEdges(FANOUT));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_DirectedAcyclicGraph, DISABLED_Benchmark) {
+  benchmarkReduce(1000000);
+}
+
+// ____________________________________________________________________________
+// Planet scale variant, run with --gtest_also_run_disabled_tests
+TEST(UTIL_DirectedAcyclicGraph, DISABLED_Benchmark100M) {
+  benchmarkReduce(100000000);
+}
+
+}  // namespace osm2rdf::util
@@ -36,12 +36,14 @@ TEST(UTIL_DirectedGraph, CopyConstructor) {
   g.addEdge(1, 2);
   g.addEdge(1, 2);
   g.addEdge(2, 1);
+  g.freeze();
   ASSERT_EQ(2, g.getNumVertices());
   ASSERT_EQ(3, g.getNumEdges());
   osm2rdf::util::DirectedGraph g2{g};
   ASSERT_EQ(2, g2.getNumVertices());
   ASSERT_EQ(3, g2.getNumEdges());
   g2.addEdge(2, 3);
+  g2.freeze();
   ASSERT_EQ(2, g.getNumVertices());
   ASSERT_EQ(3, g.getNumEdges());
   ASSERT_EQ(3, g2.getNumVertices());
@@ -55,17 +57,37 @@ TEST(UTIL_DirectedGraph, addEdge) {
   ASSERT_EQ(0, g.getNumEdges());
   // Allows multiple edges between vertices
   g.addEdge(1, 2);
+  g.freeze();
   ASSERT_EQ(2, g.getNumVertices());
   ASSERT_EQ(1, g.getNumEdges());
   g.addEdge(1, 2);
+  g.freeze();
   ASSERT_EQ(2, g.getNumVertices());
   ASSERT_EQ(2, g.getNumEdges());
   // Allows creation of cycles
   g.addEdge(2, 1);
+  g.freeze();
   ASSERT_EQ(2, g.getNumVertices());
   ASSERT_EQ(3, g.getNumEdges());
 }
 
+// ____________________________________________________________________________
+TEST(UTIL_DirectedGraph, freeze) {
+  osm2rdf::util::DirectedGraph<uint8_t> g{};
+  ASSERT_TRUE(g.isFrozen());
+  g.addEdge(1, 2);
+  ASSERT_FALSE(g.isFrozen());
+  g.freeze();
+  ASSERT_TRUE(g.isFrozen());
+  ASSERT_EQ(2, g.getNumVertices());
+  // adding an edge thaws the graph, existing edges are kept
+  g.addEdge(2, 3);
+  ASSERT_FALSE(g.isFrozen());
+  g.freeze();
+  ASSERT_EQ(3, g.getNumVertices());
+  ASSERT_EQ(std::vector<uint8_t>{2}, g.getEdges(1));
+}
+
 // ____________________________________________________________________________
 TEST(UTIL_DirectedGraph, findSuccessors) {
   osm2rdf::util::DirectedGraph<uint8_t> g{};
@@ -75,12 +97,14 @@ TEST(UTIL_DirectedGraph, findSuccessors) {
   }
   {
     g.addEdge(1, 2);
+    g.freeze();
     auto res = g.findSuccessors(1);
     ASSERT_EQ(1, res.size());
     ASSERT_EQ(2, res[0]);
   }
   {
     g.addEdge(1, 0);
+    g.freeze();
     auto res = g.findSuccessors(1);
     ASSERT_EQ(2, res.size());
     ASSERT_EQ(0, res[0]);
@@ -88,6 +112,7 @@ TEST(UTIL_DirectedGraph, findSuccessors) {
   }
   {
     g.addEdge(1, 2);
+    g.freeze();
     auto res = g.findSuccessors(1);
     ASSERT_EQ(2, res.size());
     ASSERT_EQ(0, res[0]);
@@ -101,6 +126,7 @@ TEST(UTIL_DirectedGraph, findSuccessorsFast) {
   g.addEdge(1, 2);
   g.addEdge(1, 0);
   g.addEdge(1, 2);
+  g.freeze();
   { ASSERT_ANY_THROW(g.findSuccessorsFast(1)); }
   g.prepareFindSuccessorsFast();
   {
@@ -122,6 +148,7 @@ TEST(UTIL_DirectedGraph, sort) {
     g.addEdge(1, 2);
     g.addEdge(1, 0);
     g.addEdge(1, 2);
+    g.freeze();
   }
   {
     auto res = g.getEdges(1);
@@ -138,6 +165,7 @@ TEST(UTIL_DirectedGraph, prepareFindSuccessorsFast) {
   g.addEdge(1, 2);
   g.addEdge(1, 0);
   g.addEdge(1, 2);
+  g.freeze();
   { ASSERT_ANY_THROW(g.findSuccessorsFast(1)); }
   {
     g.prepareFindSuccessorsFast();
@@ -154,12 +182,16 @@ TEST(UTIL_DirectedGraph, getNumEdges) {
   ASSERT_EQ(0, g.getNumEdges());
   // Count each edge, allows multiple edges between the same vertices.
   g.addEdge(1, 2);
+  g.freeze();
   ASSERT_EQ(1, g.getNumEdges());
   g.addEdge(1, 2);
+  g.freeze();
   ASSERT_EQ(2, g.getNumEdges());
   g.addEdge(1, 2);
+  g.freeze();
   ASSERT_EQ(3, g.getNumEdges());
   g.addEdge(3, 4);
+  g.freeze();
   ASSERT_EQ(4, g.getNumEdges());
 }
 
@@ -169,13 +201,17 @@ TEST(UTIL_DirectedGraph, getNumVertices) {
   ASSERT_EQ(0, g.getNumVertices());
   // Counts each vertex only once...
   g.addEdge(1, 1);
+  g.freeze();
   ASSERT_EQ(1, g.getNumVertices());
   g.addEdge(1, 1);
+  g.freeze();
   ASSERT_EQ(1, g.getNumVertices());
   // ... but counts all unique vertices.
   g.addEdge(1, 2);
+  g.freeze();
   ASSERT_EQ(2, g.getNumVertices());
   g.addEdge(3, 4);
+  g.freeze();
   ASSERT_EQ(4, g.getNumVertices());
 }
 
@@ -188,12 +224,14 @@ TEST(UTIL_DirectedGraph, getVertices) {
   }
   {
     g.addEdge(1, 1);
+    g.freeze();
     auto res = g.getVertices();
     ASSERT_EQ(1, res.size());
     ASSERT_EQ(1, res[0]);
   }
   {
     g.addEdge(3, 1);
+    g.freeze();
     auto res = g.getVertices();
     std::sort(res.begin(), res.end());
     ASSERT_EQ(2, res.size());
@@ -202,6 +240,7 @@ TEST(UTIL_DirectedGraph, getVertices) {
   }
   {
     g.addEdge(1, 2);
+    g.freeze();
     auto res = g.getVertices();
     std::sort(res.begin(), res.end());
     ASSERT_EQ(3, res.size());
@@ -216,18 +255,21 @@ TEST(UTIL_DirectedGraph, getEdges) {
   osm2rdf::util::DirectedGraph<uint8_t> g{};
   {
     g.addEdge(1, 1);
+    g.freeze();
     const auto res = g.getEdges(1);
     ASSERT_EQ(1, res.size());
     ASSERT_EQ(1, res[0]);
   }
   {
     g.addEdge(3, 1);
+    g.freeze();
     const auto res = g.getEdges(1);
     ASSERT_EQ(1, res.size());
     ASSERT_EQ(1, res[0]);
   }
   {
     g.addEdge(1, 3);
+    g.freeze();
     const auto res = g.getEdges(1);
     ASSERT_EQ(2, res.size());
     ASSERT_EQ(1, res[0]);
@@ -235,6 +277,7 @@ TEST(UTIL_DirectedGraph, getEdges) {
   }
   {
     g.addEdge(1, 2);
+    g.freeze();
     const auto res = g.getEdges(1);
     ASSERT_EQ(3, res.size());
     ASSERT_EQ(1, res[0]);
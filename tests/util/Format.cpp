@@ -0,0 +1,193 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "osm2rdf/util/Format.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "util/String.h"
+
+namespace osm2rdf::util {
+
+// ____________________________________________________________________________
+std::string fixed(double v, size_t prec) {
+  char buf[FORMAT_BUFFER_SIZE];
+  return {buf, formatFixed(v, prec, buf)};
+}
+
+// ____________________________________________________________________________
+std::string flt(double v, size_t prec, bool trimZeros = true) {
+  char buf[FORMAT_BUFFER_SIZE];
+  return {buf, formatFloat(v, prec, buf, trimZeros)};
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, formatFixedInteger) {
+  ASSERT_EQ("0", fixed(0, 7));
+  ASSERT_EQ("48", fixed(48, 7));
+  ASSERT_EQ("-180", fixed(-180, 7));
+  ASSERT_EQ("1000", fixed(1000, 1));
+  ASSERT_EQ("3", fixed(3.2, 0));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, formatFixedFraction) {
+  ASSERT_EQ("7.5", fixed(7.5, 7));
+  ASSERT_EQ("48.1", fixed(48.1, 7));
+  ASSERT_EQ("-7.8519012", fixed(-7.8519012, 7));
+  ASSERT_EQ("0.0000001", fixed(0.0000001, 7));
+  ASSERT_EQ("-0.0000001", fixed(-0.0000001, 7));
+  ASSERT_EQ("7.85", fixed(7.8519012, 2));
+  ASSERT_EQ("8", fixed(7.9999999, 3));
+  // like printf, negative values rounding to zero keep their sign
+  ASSERT_EQ("-0", fixed(-0.00000001, 7));
+  ASSERT_EQ("-0", fixed(-0.0, 7));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, formatFixedTie) {
+  // exact ties are rounded to even, like printf
+  ASSERT_EQ("0", fixed(0.5, 0));
+  ASSERT_EQ("2", fixed(2.5, 0));
+  ASSERT_EQ("-2", fixed(-2.5, 0));
+  ASSERT_EQ("0.12", fixed(0.125, 2));
+  // slightly below the tie as a double
+  ASSERT_EQ("0.1", fixed(0.15, 1));
+  ASSERT_EQ("1", fixed(1.00000005, 7));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, formatFixedFallback) {
+  ASSERT_EQ("7.5", fixed(7.5, 12));
+  ASSERT_EQ("0.000000000001", fixed(0.000000000001, 12));
+  ASSERT_EQ("10000000000000000000", fixed(1e19, 1));
+  ASSERT_EQ("nan", fixed(std::nan(""), 7));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, formatFixedMatchesPrintf) {
+  char ref[FORMAT_BUFFER_SIZE];
+  for (int32_t i = -1800000000; i <= 1800000000; i += 12345677) {
+    const double v = i / 10000000.0;
+    std::string expected{ref, static_cast<size_t>(snprintf(
+                                  ref, sizeof(ref), "%.7f", v))};
+    expected.erase(expected.find_last_not_of('0') + 1);
+    if (expected.back() == '.') expected.pop_back();
+    ASSERT_EQ(expected, fixed(v, 7));
+  }
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, formatFixedMatchesUtil) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-180, 180);
+  std::uniform_int_distribution<int64_t> digits(-1800000000, 1800000000);
+  for (size_t i = 0; i < 100000; i++) {
+    const double v = dist(gen);
+    for (size_t prec = 0; prec <= FIXED_MAX_PRECISION; prec++) {
+      ASSERT_EQ(::util::formatFloat(v, prec), fixed(v, prec)) << v;
+    }
+    // values close to a tie and values rounding to zero
+    const double tie = (digits(gen) + 0.5) / 10000000.0;
+    ASSERT_EQ(::util::formatFloat(tie, 7), fixed(tie, 7)) << tie;
+    ASSERT_EQ(::util::formatFloat(v / 1e9, 7), fixed(v / 1e9, 7)) << v;
+  }
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, formatFloat) {
+  ASSERT_EQ("0", flt(0, 4));
+  ASSERT_EQ("12345.6789", flt(12345.6789, 4));
+  ASSERT_EQ("12345.68", flt(12345.6789, 2));
+  ASSERT_EQ("-0.5", flt(-0.5, 2));
+  ASSERT_EQ("100", flt(100.0001, 2));
+  ASSERT_EQ("123456789012345", flt(123456789012345.0, 4));
+  ASSERT_EQ("1e+80", flt(1e80, 4));
+  ASSERT_EQ("inf", flt(INFINITY, 4));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, formatFloatNoTrim) {
+  ASSERT_EQ("0.000000", flt(0, 6, false));
+  ASSERT_EQ(std::to_string(12.5), flt(12.5, 6, false));
+  ASSERT_EQ(std::to_string(1234.56789012), flt(1234.56789012, 6, false));
+  ASSERT_EQ(std::to_string(-3.0000004), flt(-3.0000004, 6, false));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, formatFloatMatchesUtil) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1e9, 1e9);
+  for (size_t i = 0; i < 10000; i++) {
+    const double v = dist(gen);
+    ASSERT_EQ(::util::formatFloat(v, 2), flt(v, 2));
+    ASSERT_EQ(::util::formatFloat(v, 4), flt(v, 4));
+    ASSERT_EQ(::util::formatFloat(v / 1e7, 7), flt(v / 1e7, 7));
+  }
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Format, DISABLED_Benchmark) {
+  const size_t n = 1000000;
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(0, 1e6);
+  std::vector<double> values(n);
+  for (auto& v : values) v = dist(gen);
+
+  char buf[FORMAT_BUFFER_SIZE];
+  size_t utilLen = 0;
+  const auto utilStart = std::chrono::steady_clock::now();
+  for (const auto v : values) {
+    utilLen += ::util::formatFloat(v, 4).size();
+  }
+  const std::chrono::duration<double> utilTime =
+      std::chrono::steady_clock::now() - utilStart;
+
+  size_t floatLen = 0;
+  const auto floatStart = std::chrono::steady_clock::now();
+  for (const auto v : values) {
+    floatLen += formatFloat(v, 4, buf);
+  }
+  const std::chrono::duration<double> floatTime =
+      std::chrono::steady_clock::now() - floatStart;
+
+  size_t fixedLen = 0;
+  const auto fixedStart = std::chrono::steady_clock::now();
+  for (const auto v : values) {
+    fixedLen += formatFixed(v, 4, buf);
+  }
+  const std::chrono::duration<double> fixedTime =
+      std::chrono::steady_clock::now() - fixedStart;
+
+  std::cerr << "::util::formatFloat: " << (n / utilTime.count())
+            << " values/s\n"
+            << "formatFloat:         " << (n / floatTime.count())
+            << " values/s\n"
+            << "formatFixed:         " << (n / fixedTime.count())
+            << " values/s\n";
+  ASSERT_EQ(utilLen, floatLen);
+}
+
+}  // namespace osm2rdf::util
@@ -18,7 +18,11 @@
 
 #include "osm2rdf/util/Output.h"
 
+#include <fstream>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -198,4 +202,64 @@ TEST(UTIL_OutputMergeMode, CONCATENATE) {
   ASSERT_FALSE(std::filesystem::exists(config.output));
 }
 
+// ____________________________________________________________________________
+TEST(UTIL_OutputMergeMode, spatialRelationsOutputWithStdOut) {
+  osm2rdf::config::Config config;
+  const auto dir =
+      config.getTempPath("TEST_UTIL_OutputMergeMode", "spatialRelations");
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  // Main output on stdout is never merged
+  config.output = "";
+  config.outputCompress = osm2rdf::config::NONE;
+  config.mergeOutput = OutputMergeMode::NONE;
+  config.spatialRelationsOutput = dir / "relations";
+  config.spatialRelationsOutputCompress = osm2rdf::config::NONE;
+
+  const auto relConfig = config.getSpatialRelationsConfig();
+  size_t parts = 4;
+  osm2rdf::util::Output o{relConfig, relConfig.output, parts};
+  o.open();
+  o.write("a", 0);
+  o.write("b", 1);
+  o.write("c", 2);
+  o.write("d", 3);
+  o.flush();
+  o.close();
+
+  // Only the merged file is left
+  ASSERT_EQ(1, countFilesInPath(dir));
+  std::ifstream in{config.spatialRelationsOutput};
+  std::stringstream content;
+  content << in.rdbuf();
+  ASSERT_EQ("abcd", content.str());
+
+  std::filesystem::remove_all(dir);
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Output, merge) {
+  osm2rdf::config::Config config;
+  config.output = config.getTempPath("TEST_UTIL_Output", "merge");
+  std::filesystem::remove_all(config.output);
+  std::filesystem::create_directories(config.output);
+  std::filesystem::path output{config.output};
+
+  std::vector<std::string> files;
+  for (const auto& content : {"a\n", "", "b\nc\n"}) {
+    files.push_back(output / ("stripe" + std::to_string(files.size())));
+    std::ofstream f{files.back()};
+    f << content;
+  }
+
+  ASSERT_TRUE(osm2rdf::util::Output::merge(files, output / "merged"));
+  std::ifstream merged{output / "merged"};
+  std::stringstream buffer;
+  buffer << merged.rdbuf();
+  ASSERT_EQ("a\nb\nc\n", buffer.str());
+
+  std::filesystem::remove_all(config.output);
+  ASSERT_FALSE(std::filesystem::exists(config.output));
+}
+
 }  // namespace osm2rdf::util
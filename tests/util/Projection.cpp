@@ -0,0 +1,119 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "osm2rdf/util/Projection.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "util/geo/Geo.h"
+
+namespace osm2rdf::util {
+
+static const double TEST_PREC = 10.0;
+
+// ____________________________________________________________________________
+::util::geo::I32Point scalar(const ::util::geo::DPoint& p) {
+  const auto m = ::util::geo::latLngToWebMerc(p);
+  return {static_cast<int32_t>(m.getX() * TEST_PREC),
+          static_cast<int32_t>(m.getY() * TEST_PREC)};
+}
+
+// ____________________________________________________________________________
+std::vector<::util::geo::DPoint> randomPoints(size_t n) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> lon(-180.0, 180.0);
+  std::uniform_real_distribution<double> lat(-85.0, 85.0);
+  std::vector<::util::geo::DPoint> res;
+  res.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    res.emplace_back(lon(gen), lat(gen));
+  }
+  return res;
+}
+
+// ____________________________________________________________________________
+std::vector<double> interleave(const std::vector<::util::geo::DPoint>& points) {
+  std::vector<double> res;
+  res.reserve(points.size() * 2);
+  for (const auto& p : points) {
+    res.push_back(p.getX());
+    res.push_back(p.getY());
+  }
+  return res;
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Projection, empty) {
+  ::util::geo::I32Point out{1, 2};
+  projectWebMercBatch(nullptr, &out, 0, TEST_PREC);
+  ASSERT_EQ(1, out.getX());
+  ASSERT_EQ(2, out.getY());
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Projection, origin) {
+  const double in[2] = {0.0, 0.0};
+  ::util::geo::I32Point out{1, 1};
+  projectWebMercBatch(in, &out, 1, TEST_PREC);
+  ASSERT_EQ(0, out.getX());
+  ASSERT_EQ(0, out.getY());
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Projection, matchesScalar) {
+  const auto points = randomPoints(1001);
+  const auto lngLat = interleave(points);
+  std::vector<::util::geo::I32Point> out(points.size());
+  projectWebMercBatch(lngLat.data(), out.data(), points.size(), TEST_PREC);
+  for (size_t i = 0; i < points.size(); i++) {
+    const auto expected = scalar(points[i]);
+    ASSERT_EQ(expected.getX(), out[i].getX()) << i;
+    ASSERT_EQ(expected.getY(), out[i].getY()) << i;
+  }
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Projection, DISABLED_Benchmark) {
+  const size_t n = 1000000;
+  const auto points = randomPoints(n);
+  const auto lngLat = interleave(points);
+  std::vector<::util::geo::I32Point> out(n);
+  std::vector<::util::geo::I32Point> scalarOut(n);
+
+  const auto scalarStart = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < n; i++) {
+    scalarOut[i] = scalar(points[i]);
+  }
+  const std::chrono::duration<double> scalarTime =
+      std::chrono::steady_clock::now() - scalarStart;
+
+  const auto batchStart = std::chrono::steady_clock::now();
+  projectWebMercBatch(lngLat.data(), out.data(), n, TEST_PREC);
+  const std::chrono::duration<double> batchTime =
+      std::chrono::steady_clock::now() - batchStart;
+
+  std::cerr << "scalar: " << (n / scalarTime.count()) << " points/s\n"
+            << "batch:  " << (n / batchTime.count()) << " points/s\n";
+  ASSERT_EQ(scalarOut[n - 1].getY(), out[n - 1].getY());
+}
+
+}  // namespace osm2rdf::util
@@ -0,0 +1,145 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "osm2rdf/util/Scan.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace osm2rdf::util {
+
+// ____________________________________________________________________________
+TEST(UTIL_Scan, findLiteralEscape) {
+  ASSERT_EQ(0, findLiteralEscape(""));
+  ASSERT_EQ(5, findLiteralEscape("Hallo"));
+  ASSERT_EQ(2, findLiteralEscape("Ha\"llo"));
+  ASSERT_EQ(40, findLiteralEscape(std::string(40, 'a') + "\\" +
+                                  std::string(40, 'a')));
+  ASSERT_EQ(33, findLiteralEscape(std::string(33, 'a') + "\n"));
+  ASSERT_EQ(16, findLiteralEscape(std::string(16, 'a') + "\r"));
+  ASSERT_EQ(22, findLiteralEscape("Straße mit Ümlaut <>"));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Scan, findIRIREFEscape) {
+  ASSERT_EQ(0, findIRIREFEscape(""));
+  ASSERT_EQ(26, findIRIREFEscape("https://example.org/a?b=c#"));
+  ASSERT_EQ(5, findIRIREFEscape("Hallo Welt"));
+  ASSERT_EQ(40, findIRIREFEscape(std::string(40, 'a') + "}"));
+  ASSERT_EQ(32, findIRIREFEscape(std::string(32, 'a') + std::string(1, '\0')));
+  ASSERT_EQ(7, findIRIREFEscape("Straße`"));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Scan, findPNLocalSpecial) {
+  ASSERT_EQ(0, findPNLocalSpecial(""));
+  ASSERT_EQ(7, findPNLocalSpecial("name:de"));
+  ASSERT_EQ(4, findPNLocalSpecial("addr-street"));
+  ASSERT_EQ(0, findPNLocalSpecial("."));
+  ASSERT_EQ(40, findPNLocalSpecial(std::string(40, 'Z') + "@"));
+  ASSERT_EQ(35, findPNLocalSpecial(std::string(35, '_') + "\xC3\x9F"));
+  ASSERT_EQ(3, findPNLocalSpecial("abc`"));
+  ASSERT_EQ(3, findPNLocalSpecial("abc["));
+  ASSERT_EQ(3, findPNLocalSpecial("abc{"));
+  ASSERT_EQ(3, findPNLocalSpecial("abc;"));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Scan, matchesScalar) {
+  // Every byte value at every position of blocks and tails.
+  for (size_t len = 1; len < 70; len++) {
+    for (int c = 0; c < 256; c++) {
+      for (size_t pos = 0; pos < len; pos += 7) {
+        std::string s(len, 'a');
+        s[pos] = static_cast<char>(c);
+        ASSERT_EQ(findLiteralEscapeScalar(s), findLiteralEscape(s));
+        ASSERT_EQ(findIRIREFEscapeScalar(s), findIRIREFEscape(s));
+        ASSERT_EQ(findPNLocalSpecialScalar(s), findPNLocalSpecial(s));
+      }
+    }
+  }
+}
+
+// ____________________________________________________________________________
+std::vector<std::string> tagValues(size_t n) {
+  // Mix of typical OSM tag values: short words, names with UTF-8, numbers,
+  // opening hours, and longer descriptions with occasional quotes.
+  const std::vector<std::string> samples = {
+      "yes",
+      "residential",
+      "Hauptstraße",
+      "12",
+      "Mo-Fr 08:00-18:00; Sa 09:00-13:00",
+      "Санкт-Петербург",
+      "https://www.example.org/some/path?query=1",
+      "Q1234567",
+      "de:Freiburg im Breisgau",
+      "Der \"Alte\" Friedhof ist ein ehemaliger Friedhof in Freiburg im "
+      "Breisgau, der von 1683 bis 1872 genutzt wurde.",
+  };
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<size_t> dist(0, samples.size() - 1);
+  std::vector<std::string> values(n);
+  for (auto& v : values) v = samples[dist(gen)];
+  return values;
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Scan, DISABLED_Benchmark) {
+  const auto values = tagValues(1000000);
+  size_t bytes = 0;
+  for (const auto& v : values) bytes += v.size();
+
+  // Scan each value completely, as writeLiteral does.
+  const auto scan = [&values](size_t (*find)(std::string_view)) {
+    size_t found = 0;
+    for (const auto& v : values) {
+      std::string_view s = v;
+      size_t pos;
+      while ((pos = find(s)) != s.size()) {
+        found++;
+        s.remove_prefix(pos + 1);
+      }
+    }
+    return found;
+  };
+
+  const auto scalarStart = std::chrono::steady_clock::now();
+  const size_t scalarFound = scan(findLiteralEscapeScalar);
+  const std::chrono::duration<double> scalarTime =
+      std::chrono::steady_clock::now() - scalarStart;
+
+  const auto simdStart = std::chrono::steady_clock::now();
+  const size_t simdFound = scan(findLiteralEscape);
+  const std::chrono::duration<double> simdTime =
+      std::chrono::steady_clock::now() - simdStart;
+
+  std::cerr << "findLiteralEscapeScalar: "
+            << (bytes / scalarTime.count() / 1e6) << " MB/s\n"
+            << "findLiteralEscape:       " << (bytes / simdTime.count() / 1e6)
+            << " MB/s\n";
+  ASSERT_EQ(scalarFound, simdFound);
+}
+
+}  // namespace osm2rdf::util
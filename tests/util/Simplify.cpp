@@ -0,0 +1,165 @@
+// Copyright 2025, University of Freiburg
+// Authors: Patrick Brosi <brosi@cs.uni-freiburg.de>
+
+// This file is part of osm2rdf.
+//
+// osm2rdf is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// osm2rdf is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with osm2rdf.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "osm2rdf/util/Simplify.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "util/geo/Geo.h"
+
+namespace osm2rdf::util {
+
+// ____________________________________________________________________________
+double segmentDist(const ::util::geo::DPoint& a, const ::util::geo::DPoint& b,
+                   const ::util::geo::DPoint& p) {
+  const double dx = b.getX() - a.getX();
+  const double dy = b.getY() - a.getY();
+  const double len2 = dx * dx + dy * dy;
+  double t = 0;
+  if (len2 > 0) {
+    t = ((p.getX() - a.getX()) * dx + (p.getY() - a.getY()) * dy) / len2;
+    t = std::max(0.0, std::min(1.0, t));
+  }
+  return std::hypot(p.getX() - (a.getX() + t * dx),
+                    p.getY() - (a.getY() + t * dy));
+}
+
+// ____________________________________________________________________________
+void recursiveDP(const ::util::geo::DLine& line, size_t from, size_t to,
+                 double maxDeviation, ::util::geo::DLine* res) {
+  double maxd = 0;
+  size_t maxi = from;
+  for (size_t i = from + 1; i < to; i++) {
+    const double d = segmentDist(line[from], line[to], line[i]);
+    if (d > maxd) {
+      maxd = d;
+      maxi = i;
+    }
+  }
+  if (maxd <= maxDeviation) {
+    res->push_back(line[to]);
+    return;
+  }
+  recursiveDP(line, from, maxi, maxDeviation, res);
+  recursiveDP(line, maxi, to, maxDeviation, res);
+}
+
+// ____________________________________________________________________________
+::util::geo::DLine randomWalk(size_t n, bool closed) {
+  std::mt19937 gen(42);
+  std::normal_distribution<double> step(0, 0.001);
+  ::util::geo::DLine res;
+  double x = 7.8;
+  double y = 48.0;
+  for (size_t i = 0; i < n; i++) {
+    res.push_back({x, y});
+    x += step(gen) + 0.0001;
+    y += step(gen);
+  }
+  if (closed) res.push_back(res.front());
+  return res;
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Simplify, lineKeepsEndPoints) {
+  const ::util::geo::DLine line{{0, 0}, {0, 80}, {0, 160}, {0, 1000}};
+  const auto res = simplify(line, 5);
+  ASSERT_EQ(2, res.size());
+  ASSERT_EQ(0, res[0].getY());
+  ASSERT_EQ(1000, res[1].getY());
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Simplify, lineKeepsDeviatingPoint) {
+  const ::util::geo::DLine line{{0, 0}, {0, 80}, {100, 1000}};
+  ASSERT_EQ(3, simplify(line, 5).size());
+  ASSERT_EQ(2, simplify(line, 80).size());
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Simplify, matchesRecursive) {
+  const auto line = randomWalk(10000, false);
+  for (double maxDeviation : {0.0, 0.0005, 0.002, 0.01, 0.1}) {
+    ::util::geo::DLine expected{line.front()};
+    recursiveDP(line, 0, line.size() - 1, maxDeviation, &expected);
+    const auto res = simplify(line, maxDeviation);
+    ASSERT_EQ(expected.size(), res.size()) << maxDeviation;
+    for (size_t i = 0; i < res.size(); i++) {
+      ASSERT_EQ(expected[i].getX(), res[i].getX());
+      ASSERT_EQ(expected[i].getY(), res[i].getY());
+    }
+  }
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Simplify, ringStaysValid) {
+  ::util::geo::DPolygon polygon;
+  polygon.getOuter() = randomWalk(1000, true);
+  polygon.getInners().push_back({{7.81, 48}, {7.82, 48}, {7.82, 48.01},
+                                 {7.81, 48.01}, {7.81, 48}});
+
+  // A deviation larger than the geometry collapses everything.
+  const auto res = simplify(polygon, 1000);
+  ASSERT_EQ(4, res.getOuter().size());
+  ASSERT_EQ(res.getOuter().front().getX(), res.getOuter().back().getX());
+  ASSERT_EQ(res.getOuter().front().getY(), res.getOuter().back().getY());
+  ASSERT_EQ(1, res.getInners().size());
+  ASSERT_EQ(4, res.getInners()[0].size());
+
+  const ::util::geo::DMultiPolygon multiPolygon{polygon, polygon};
+  const auto mpRes = simplify(multiPolygon, 1000);
+  ASSERT_EQ(2, mpRes.size());
+  ASSERT_EQ(4, mpRes[1].getOuter().size());
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Simplify, collection) {
+  ::util::geo::DCollection collection;
+  collection.push_back(::util::geo::DPoint{1, 2});
+  collection.push_back(::util::geo::DLine{{0, 0}, {0, 1}, {0, 2}});
+  const auto res = simplify(collection, 0.5);
+  ASSERT_EQ(2, res.size());
+  ASSERT_EQ(0, res[0].getType());
+  ASSERT_EQ(2, res[0].getPoint().getY());
+  ASSERT_EQ(1, res[1].getType());
+  ASSERT_EQ(2, res[1].getLine().size());
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Simplify, DISABLED_Benchmark) {
+  // Coastline sized ring.
+  ::util::geo::DPolygon polygon;
+  polygon.getOuter() = randomWalk(1000000, true);
+  const double maxDeviation = 0.01;
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto res = simplify(polygon, maxDeviation);
+  const std::chrono::duration<double> time =
+      std::chrono::steady_clock::now() - start;
+
+  std::cerr << "simplified " << polygon.getOuter().size() << " to "
+            << res.getOuter().size() << " points in " << time.count()
+            << "s\n";
+  ASSERT_GE(res.getOuter().size(), 4);
+}
+
+}  // namespace osm2rdf::util
@@ -18,6 +18,13 @@
 
 #include "osm2rdf/util/Time.h"
 
+#include <time.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace osm2rdf::util {
@@ -46,4 +53,84 @@ TEST(UTIL_Time, formattedTimeSpacer) {
   }
 }
 
-}  // namespace osm2rdf::util
\ No newline at end of file
+// ____________________________________________________________________________
+std::string formatWithGmtime(time_t seconds) {
+  struct tm t;
+  gmtime_r(&seconds, &t);
+  char buf[32];
+  strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &t);
+  return buf;
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Time, ISOTimeFormatter) {
+  ISOTimeFormatter f;
+  char buf[ISO_TIME_LENGTH];
+  f.format(0, buf);
+  ASSERT_EQ("1970-01-01T00:00:00", std::string(buf, ISO_TIME_LENGTH));
+  f.format(1555936496, buf);
+  ASSERT_EQ("2019-04-22T12:34:56", std::string(buf, ISO_TIME_LENGTH));
+  // same day, cached date
+  f.format(1555936496 + 3600, buf);
+  ASSERT_EQ("2019-04-22T13:34:56", std::string(buf, ISO_TIME_LENGTH));
+  f.format(951782400, buf);
+  ASSERT_EQ("2000-02-29T00:00:00", std::string(buf, ISO_TIME_LENGTH));
+  f.format(-1, buf);
+  ASSERT_EQ("1969-12-31T23:59:59", std::string(buf, ISO_TIME_LENGTH));
+  f.format(253402300799, buf);
+  ASSERT_EQ("9999-12-31T23:59:59", std::string(buf, ISO_TIME_LENGTH));
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Time, ISOTimeFormatterMatchesGmtime) {
+  ISOTimeFormatter f;
+  char buf[ISO_TIME_LENGTH];
+  std::mt19937 gen(42);
+  // 1900 to 2200
+  std::uniform_int_distribution<int64_t> dist(-2208988800, 7258118400);
+  for (size_t i = 0; i < 100000; i++) {
+    const int64_t t = dist(gen);
+    f.format(t, buf);
+    ASSERT_EQ(formatWithGmtime(t), std::string(buf, ISO_TIME_LENGTH));
+  }
+}
+
+// ____________________________________________________________________________
+TEST(UTIL_Time, DISABLED_Benchmark) {
+  const size_t n = 1000000;
+  std::mt19937 gen(42);
+  // OSM timestamps, 2005 to 2025
+  std::uniform_int_distribution<int64_t> dist(1104537600, 1735689600);
+  std::vector<time_t> values(n);
+  for (auto& v : values) v = dist(gen);
+
+  size_t gmtimeSum = 0;
+  const auto gmtimeStart = std::chrono::steady_clock::now();
+  for (const auto v : values) {
+    struct tm t;
+    gmtime_r(&v, &t);
+    gmtimeSum += t.tm_year + t.tm_mon + t.tm_mday + t.tm_sec;
+  }
+  const std::chrono::duration<double> gmtimeTime =
+      std::chrono::steady_clock::now() - gmtimeStart;
+
+  ISOTimeFormatter f;
+  char buf[ISO_TIME_LENGTH];
+  size_t formatterSum = 0;
+  const auto formatterStart = std::chrono::steady_clock::now();
+  for (const auto v : values) {
+    f.format(v, buf);
+    formatterSum += buf[3] + buf[6] + buf[9] + buf[18];
+  }
+  const std::chrono::duration<double> formatterTime =
+      std::chrono::steady_clock::now() - formatterStart;
+
+  std::cerr << "gmtime_r:         " << (n / gmtimeTime.count())
+            << " timestamps/s\n"
+            << "ISOTimeFormatter: " << (n / formatterTime.count())
+            << " timestamps/s\n";
+  ASSERT_NE(0, gmtimeSum);
+  ASSERT_NE(0, formatterSum);
+}
+
+}  // namespace osm2rdf::util